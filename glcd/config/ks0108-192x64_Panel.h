@@ -45,6 +45,10 @@
  * The following conditional statements determine the relationship between the chip select
  * pins and the physical chips.
  * If the chips are displayed in the wrong order, you can swap the glcd_CHIPx defines 
+ *
+ * The optional glcd_CHIPALL define selects every chip at the same time so that pages
+ * which are identical on all the chips (like when clearing the display) are written
+ * to all the chips at once. This only works when each chip has its own select pin.
  */  
 
 /* 
@@ -58,6 +62,7 @@
 #if glcd_CHIP_COUNT == 2
 #define glcd_CHIP0 glcdCSEL1,HIGH,   glcdCSEL2,LOW
 #define glcd_CHIP1 glcdCSEL1,LOW,    glcdCSEL2,HIGH    
+//#define glcd_CHIPALL glcdCSEL1,HIGH, glcdCSEL2,HIGH	// only for panels with active high chip selects
 
 /*
  * Three Chip panel using two select pins
@@ -92,6 +97,7 @@
 #define glcd_CHIP0  glcdCSEL1,HIGH, glcdCSEL2,LOW,  glcdCSEL3,LOW
 #define glcd_CHIP1  glcdCSEL1,LOW,  glcdCSEL2,HIGH, glcdCSEL3,LOW
 #define glcd_CHIP2  glcdCSEL1,LOW,  glcdCSEL2,LOW,  glcdCSEL3,HIGH    
+#define glcd_CHIPALL glcdCSEL1,HIGH, glcdCSEL2,HIGH, glcdCSEL3,HIGH
 
 /*
  * Defines for Four Chip panel using four select pins
@@ -101,6 +107,7 @@
 #define glcd_CHIP1  glcdCSEL1,LOW,  glcdCSEL2,HIGH, glcdCSEL3,LOW,  glcdCSEL4,LOW
 #define glcd_CHIP2  glcdCSEL1,LOW,  glcdCSEL2,LOW,  glcdCSEL3,HIGH, glcdCSEL4,LOW
 #define glcd_CHIP3  glcdCSEL1,LOW,  glcdCSEL2,LOW,  glcdCSEL3,LOW,  glcdCSEL4,HIGH    
+#define glcd_CHIPALL glcdCSEL1,HIGH, glcdCSEL2,HIGH, glcdCSEL3,HIGH, glcdCSEL4,HIGH
 
 /*
  * Here if the Number of Chip Selects is not supported for the selected panel size and chip size
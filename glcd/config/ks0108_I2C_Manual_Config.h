@@ -0,0 +1,124 @@
+/*
+ * ks0108_I2C_Manual_Config.h - User specific configuration for Arduino GLCD library
+ *
+ * Use this file to set io pins and LCD panel parameters
+ * This version is for a standard ks0108 display
+ * connected through a MCP23017 16 bit I2C port expander.
+ *
+ *    port A GPA0-GPA7 -> glcd D0-D7
+ *    port B GPB0-GPB7 -> EX_B0-EX_B7 below (DI, RW, EN, CS1, CS2, RST)
+ *
+ * This needs only the 2 I2C pins (SDA and SCL, with pullups)
+ * and the bus can still be shared with other I2C devices.
+ * The expander address pins A0-A2 select the address below.
+ *
+ * The glcd is never read back through the expander so:
+ *  - the read cache (GLCD_READ_CACHE) is always used
+ *  - the busy status is never read, the timed busy mode (GLCD_BUSY_TIMED) is used
+ *  - the initialization status checks are not done (GLCD_NOINIT_CHECKS)
+ *
+*/
+
+#ifndef GLCD_PANEL_CONFIG_H
+#define GLCD_PANEL_CONFIG_H
+
+/*
+ * define name for panel configuration
+ */
+#define glcd_PanelConfigName "ks0108-I2C-Manual"
+
+/*********************************************************/
+/*  Configuration for LCD panel specific configuration   */
+/*********************************************************/
+#define DISPLAY_WIDTH 128
+#define DISPLAY_HEIGHT 64
+
+// panel controller chips
+#define CHIP_WIDTH     64  // pixels per chip
+#define CHIP_HEIGHT    64  // pixels per chip
+
+/*********************************************************/
+/*  Configuration for assigning LCD bits to Arduino Pins */
+/*********************************************************/
+
+/*
+ * define name for pin configuration
+ */
+#define glcd_PinConfigName "ks0108-I2C-Manual"
+
+/*
+ * Pins can be assigned using Arduino pin numbers 0-n
+ * Pins can also be assigned using PIN_Pb
+ *   where P is port A-L and b is bit 0-7
+ *   Example: port D pin 3 is PIN_D3
+ *
+ * All the control lines, including EN, are on port B of the expander
+ * using EX_Bb where b is the port B bit 0-7
+ *   Example: GPB2 is EX_B2
+ *
+ * The data lines are always on port A of the expander
+ * so there are no data pin definitions.
+ */
+
+/*
+ * I2C address of the MCP23017 (0x20-0x27)
+ * (defining it selects the I2C port expander bus)
+ */
+#define glcdI2C_ADDR     0x20
+
+/* Control lines, all on port B of the expander
+ */
+#define glcdDI            EX_B0
+#define glcdRW            EX_B1
+#define glcdEN            EX_B2
+#define glcdCSEL1         EX_B3
+#define glcdCSEL2         EX_B4
+// Reset Bit  - uncomment the next line if reset is connected to the expander
+//#define glcdRES            EX_B5    // Reset Bit
+
+/*
+ * the following is the calculation of the number of chips - do not change
+ */
+#define glcd_CHIP_COUNT (((DISPLAY_WIDTH + CHIP_WIDTH - 1)  / CHIP_WIDTH) * ((DISPLAY_HEIGHT + CHIP_HEIGHT -1) / CHIP_HEIGHT))
+
+/*********************************************************/
+/*  Chip Select Configuration                            */
+/*********************************************************/
+
+/*
+ * Two Chip panels using two select pins (the most common panel type)
+ * If the chips are displayed in the wrong order, you can swap the glcd_CHIPx defines
+ *
+ * The optional glcd_CHIPALL define selects every chip at the same time so that pages
+ * which are identical on all the chips (like when clearing the display) are written
+ * to all the chips at once.
+ */
+#if glcd_CHIP_COUNT == 2
+#define glcd_CHIP0 glcdCSEL1,HIGH,   glcdCSEL2,LOW
+#define glcd_CHIP1 glcdCSEL1,LOW,    glcdCSEL2,HIGH
+//#define glcd_CHIPALL glcdCSEL1,HIGH, glcdCSEL2,HIGH	// only for panels with active high chip selects
+#else
+#error "ks0108_I2C_Manual_Config.h only supports two chip panels"
+#endif
+
+/*********************************************************/
+/*  End of Chip Select Configuration                     */
+/*********************************************************/
+
+/*
+ * The following defines are for panel specific low level timing.
+ *
+ * See your data sheet for the exact timing and waveforms.
+ * All defines below are in nanoseconds.
+ * The address and data setup times are always met by the time
+ * it takes to send each byte over I2C.
+ */
+
+#define GLCD_tDDR   320    /* Data Delay time (E high to valid read data)        */
+#define GLCD_tAS    140    /* Address setup time (ctrl line changes to E high)   */
+#define GLCD_tDSW   200    /* Data setup time (data lines setup to dropping E)   */
+#define GLCD_tWH    450    /* E hi level width (minimum E hi pulse width)        */
+#define GLCD_tWL    450    /* E lo level width (minimum E lo pulse width)        */
+
+#include "device/ks0108_Device.h"
+#endif //GLCD_PANEL_CONFIG_H
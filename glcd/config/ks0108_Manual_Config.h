@@ -89,12 +89,30 @@
  * The following conditional statements determine the relationship between the chip select
  * pins and the physical chips.
  * If the chips are displayed in the wrong order, you can swap the glcd_CHIPx defines 
+ *
+ * The optional glcd_CHIPALL define selects every chip at the same time so that pages
+ * which are identical on all the chips (like when clearing the display) are written
+ * to all the chips at once. This only works when each chip has its own select pin.
  */  
 
+/*
+ * Two 2 chip panels can share the data, DI, RW and EN lines when the chips of each
+ * panel have chip select pins of their own (active high, glcdCSEL1 to glcdCSEL4 above).
+ * Uncomment glcd_PANEL_COUNT to use them, GLCD.SelectPanel() picks the panel that is drawn on.
+ * The read cache and write back cache can't be used with more than one panel.
+ */
+//#define glcd_PANEL_COUNT 2
+
+#if defined(glcd_PANEL_COUNT) && (glcd_PANEL_COUNT == 2) && (glcd_CHIP_COUNT == 2)
+#define glcd_CHIP0  glcdCSEL1,HIGH, glcdCSEL2,LOW,  glcdCSEL3,LOW,  glcdCSEL4,LOW	// panel 0
+#define glcd_CHIP1  glcdCSEL1,LOW,  glcdCSEL2,HIGH, glcdCSEL3,LOW,  glcdCSEL4,LOW
+#define glcd_CHIP2  glcdCSEL1,LOW,  glcdCSEL2,LOW,  glcdCSEL3,HIGH, glcdCSEL4,LOW	// panel 1
+#define glcd_CHIP3  glcdCSEL1,LOW,  glcdCSEL2,LOW,  glcdCSEL3,LOW,  glcdCSEL4,HIGH
+
 /* 
  * Defines for Panels using two Chip Select pins
  */  
-#if  NBR_CHIP_SELECT_PINS == 2
+#elif  NBR_CHIP_SELECT_PINS == 2
 
 /*
  * Two Chip panels using two select pins (the most common panel type)
@@ -102,6 +120,7 @@
 #if glcd_CHIP_COUNT == 2
 #define glcd_CHIP0 glcdCSEL1,HIGH,   glcdCSEL2,LOW
 #define glcd_CHIP1 glcdCSEL1,LOW,    glcdCSEL2,HIGH    
+//#define glcd_CHIPALL glcdCSEL1,HIGH, glcdCSEL2,HIGH	// only for panels with active high chip selects
 
 /*
  * Three Chip panel using two select pins
@@ -136,6 +155,7 @@
 #define glcd_CHIP0  glcdCSEL1,HIGH, glcdCSEL2,LOW,  glcdCSEL3,LOW
 #define glcd_CHIP1  glcdCSEL1,LOW,  glcdCSEL2,HIGH, glcdCSEL3,LOW
 #define glcd_CHIP2  glcdCSEL1,LOW,  glcdCSEL2,LOW,  glcdCSEL3,HIGH    
+#define glcd_CHIPALL glcdCSEL1,HIGH, glcdCSEL2,HIGH, glcdCSEL3,HIGH
 
 /*
  * Defines for Four Chip panel using four select pins
@@ -145,6 +165,7 @@
 #define glcd_CHIP1  glcdCSEL1,LOW,  glcdCSEL2,HIGH, glcdCSEL3,LOW,  glcdCSEL4,LOW
 #define glcd_CHIP2  glcdCSEL1,LOW,  glcdCSEL2,LOW,  glcdCSEL3,HIGH, glcdCSEL4,LOW
 #define glcd_CHIP3  glcdCSEL1,LOW,  glcdCSEL2,LOW,  glcdCSEL3,LOW,  glcdCSEL4,HIGH    
+#define glcd_CHIPALL glcdCSEL1,HIGH, glcdCSEL2,HIGH, glcdCSEL3,HIGH, glcdCSEL4,HIGH
 
 /*
  * Here if the Number of Chip Selects is not supported for the selected panel size and chip size
@@ -0,0 +1,127 @@
+/*
+ * ks0108_SPI_Manual_Config.h - User specific configuration for Arduino GLCD library
+ *
+ * Use this file to set io pins and LCD panel parameters
+ * This version is for a standard ks0108 display
+ * connected through two 74HC595 shift registers on the hardware SPI pins.
+ *
+ * The shift registers are chained: MOSI feeds the data register whose
+ * serial out (QH') feeds the control register.
+ * Both registers share the SPI clock (SRCLK) and the latch (RCLK).
+ *
+ *    data register    Q0-Q7 -> glcd D0-D7
+ *    control register Q0-Q7 -> SR_Q0-SR_Q7 below (DI, RW, CS1, CS2, RST)
+ *
+ * This needs only 4 Arduino pins: MOSI, SCK, the latch and the glcd EN strobe.
+ *
+ * The glcd can't be read through a shift register so:
+ *  - the read cache (GLCD_READ_CACHE) is always used
+ *  - the busy status is never read, the timed busy mode (GLCD_BUSY_TIMED) is used
+ *  - the initialization status checks are not done (GLCD_NOINIT_CHECKS)
+ *
+*/
+
+#ifndef GLCD_PANEL_CONFIG_H
+#define GLCD_PANEL_CONFIG_H
+
+/*
+ * define name for panel configuration
+ */
+#define glcd_PanelConfigName "ks0108-SPI-Manual"
+
+/*********************************************************/
+/*  Configuration for LCD panel specific configuration   */
+/*********************************************************/
+#define DISPLAY_WIDTH 128
+#define DISPLAY_HEIGHT 64
+
+// panel controller chips
+#define CHIP_WIDTH     64  // pixels per chip
+#define CHIP_HEIGHT    64  // pixels per chip
+
+/*********************************************************/
+/*  Configuration for assigning LCD bits to Arduino Pins */
+/*********************************************************/
+
+/*
+ * define name for pin configuration
+ */
+#define glcd_PinConfigName "ks0108-SPI-Manual"
+
+/*
+ * Pins can be assigned using Arduino pin numbers 0-n
+ * Pins can also be assigned using PIN_Pb
+ *   where P is port A-L and b is bit 0-7
+ *   Example: port D pin 3 is PIN_D3
+ *
+ * Control lines can also be assigned to control shift register outputs
+ * using SR_Qb where b is the output 0-7
+ *   Example: control register output Q2 is SR_Q2
+ * The EN strobe must be an Arduino pin.
+ *
+ * The data lines are always on the data shift register
+ * so there are no data pin definitions.
+ */
+
+/*
+ * shift register latch (RCLK) pin
+ * (defining it selects the shift register bus)
+ */
+#define glcdSPI_LATCH    10
+
+/* Control lines
+ */
+#define glcdDI            SR_Q0
+#define glcdRW            SR_Q1
+#define glcdCSEL1         SR_Q2
+#define glcdCSEL2         SR_Q3
+#define glcdEN            9
+// Reset Bit  - uncomment the next line if reset is connected to the shift register
+//#define glcdRES            SR_Q4    // Reset Bit
+
+/*
+ * the following is the calculation of the number of chips - do not change
+ */
+#define glcd_CHIP_COUNT (((DISPLAY_WIDTH + CHIP_WIDTH - 1)  / CHIP_WIDTH) * ((DISPLAY_HEIGHT + CHIP_HEIGHT -1) / CHIP_HEIGHT))
+
+/*********************************************************/
+/*  Chip Select Configuration                            */
+/*********************************************************/
+
+/*
+ * Two Chip panels using two select pins (the most common panel type)
+ * If the chips are displayed in the wrong order, you can swap the glcd_CHIPx defines
+ *
+ * The optional glcd_CHIPALL define selects every chip at the same time so that pages
+ * which are identical on all the chips (like when clearing the display) are written
+ * to all the chips at once.
+ */
+#if glcd_CHIP_COUNT == 2
+#define glcd_CHIP0 glcdCSEL1,HIGH,   glcdCSEL2,LOW
+#define glcd_CHIP1 glcdCSEL1,LOW,    glcdCSEL2,HIGH
+//#define glcd_CHIPALL glcdCSEL1,HIGH, glcdCSEL2,HIGH	// only for panels with active high chip selects
+#else
+#error "ks0108_SPI_Manual_Config.h only supports two chip panels"
+#endif
+
+/*********************************************************/
+/*  End of Chip Select Configuration                     */
+/*********************************************************/
+
+/*
+ * The following defines are for panel specific low level timing.
+ *
+ * See your data sheet for the exact timing and waveforms.
+ * All defines below are in nanoseconds.
+ * The address and data setup times are always met by the time
+ * it takes to shift out the control and data bytes.
+ */
+
+#define GLCD_tDDR   320    /* Data Delay time (E high to valid read data)        */
+#define GLCD_tAS    140    /* Address setup time (ctrl line changes to E high)   */
+#define GLCD_tDSW   200    /* Data setup time (data lines setup to dropping E)   */
+#define GLCD_tWH    450    /* E hi level width (minimum E hi pulse width)        */
+#define GLCD_tWL    450    /* E lo level width (minimum E lo pulse width)        */
+
+#include "device/ks0108_Device.h"
+#endif //GLCD_PANEL_CONFIG_H
@@ -0,0 +1,246 @@
+/*
+ * bench.cpp - run the glcd benchmarks on the panel model and compare results with a baseline
+ *
+ * vi:ts=4
+ *
+ * This file is part of the Arduino GLCD library host build.
+ *
+ * The benchmarks and the output format are in testsketches/GLCDbench/glcdbench.h,
+ * GLCDbench.pde runs the same benchmarks on the Arduino.
+ * On the host each benchmark is run BENCH_OPS times and the counts and time are
+ * per operation. The time is the simulated bus time only, so benchmarks that
+ * don't touch the display take 0us.
+ *
+ * usage:
+ *	bench [-t percent]							run the benchmarks
+ *	bench [-t percent] -c baseline				run them and only report the differences with the baseline
+ *	bench [-t percent] -c baseline results		compare saved results (from the Arduino for example)
+ *
+ * A count or time that went up by more than percent (default 1) is reported as
+ * a regression and the exit status is 1. Operations per second are not compared
+ * since they follow from the time.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "glcd.h"
+#include "glcd_sim.h"
+#include "../testsketches/GLCDbench/glcdbench.h"
+
+#define BENCH_OPS		16
+#define BENCH_COLUMNS	6		// ops/s us cmds writes reads busy
+#define BENCH_MAX		128
+
+static const char *column[BENCH_COLUMNS] = {"ops/s", "us", "cmds", "writes", "reads", "busy"};
+
+struct result
+{
+	char name[GLCDBENCH_NAMELEN];
+	double val[BENCH_COLUMNS];
+	uint8_t known;				// bit per column, the value is known
+};
+
+static struct result results[BENCH_MAX], baseline[BENCH_MAX];
+static int nresults, nbaseline;
+
+static void print(FILE *fp, struct result *r)
+{
+	fprintf(fp, "%-15s", r->name);
+	for(int c = 0; c < BENCH_COLUMNS; c++)
+	{
+		if(!(r->known & _BV(c)))
+			fprintf(fp, " %9s", "-");
+		else
+			fprintf(fp, c ? " %9.1f" : " %9.0f", r->val[c]);
+	}
+	fprintf(fp, "\n");
+}
+
+static void header(void)
+{
+	printf("# glcdbench %s %dx%d", glcd_PanelConfigName, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+#ifdef GLCD_READ_CACHE
+	printf(" READ_CACHE");
+#endif
+#ifdef GLCD_WRITEBACK_CACHE
+	printf(" WRITEBACK_CACHE");
+#endif
+#ifdef GLCD_DOUBLE_BUFFER
+	printf(" DOUBLE_BUFFER");
+#endif
+#ifdef GLCD_ASYNC_FLUSH
+	printf(" ASYNC_FLUSH");
+#endif
+	printf(", %d ops each, simulated bus time\n", BENCH_OPS);
+	printf("# %-13s %9s %9s %9s %9s %9s %9s\n", "name",
+		column[0], column[1], column[2], column[3], column[4], column[5]);
+}
+
+/*
+ * per operation, rounded the way it is printed so results compare the same
+ * whether they were just measured or read back from a file
+ */
+static double perop(double total)
+{
+	return(floor(total * 10 / BENCH_OPS + 0.5) / 10);
+}
+
+/*
+ * run all the benchmarks, quiet only keeps the results for the comparison
+ */
+static void run(int quiet)
+{
+glcdbench_t bench;
+
+	glcdsim_Reset(1);
+	GLCD.Init();
+	if(!quiet)
+		header();
+	for(uint8_t n = 0; n < GLCDBENCH_COUNT; n++)
+	{
+	struct result *r = &results[nresults++];
+
+		glcdbench_get(n, &bench);
+		GLCD.ClearScreen();
+		GLCD.Flush();
+		if(bench.setup)
+			bench.setup(bench.arg);
+		GLCD.Flush();
+		glcdsim_ClearCounters();
+		for(uint8_t i = 0; i < BENCH_OPS; i++)
+		{
+			bench.op(bench.arg, i);
+			GLCD.Flush();
+		}
+
+		strcpy(r->name, bench.name);
+		r->val[1] = perop(glcdsim_Nanoseconds() / 1000);
+		r->val[2] = perop(glcdsim_count.cmds);
+		r->val[3] = perop(glcdsim_count.writes);
+		r->val[4] = perop(glcdsim_count.reads);
+		r->val[5] = perop(glcdsim_count.busypolls);
+		r->known = 0x3e;
+		if(r->val[1] > 0)
+		{
+			r->val[0] = 1e6 / r->val[1];
+			r->known |= 1;
+		}
+		if(!quiet)
+			print(stdout, r);
+	}
+}
+
+/*
+ * read results in the output format, returns how many
+ */
+static int load(const char *file, struct result *r)
+{
+FILE *fp;
+char line[160], val[BENCH_COLUMNS][16];
+int n = 0;
+
+	if(!(fp = fopen(file, "r")))
+	{
+		perror(file);
+		exit(2);
+	}
+	while(fgets(line, sizeof(line), fp) && n < BENCH_MAX)
+	{
+		if(line[0] == '#' ||
+			sscanf(line, "%15s %15s %15s %15s %15s %15s %15s", r->name,
+				val[0], val[1], val[2], val[3], val[4], val[5]) != 1 + BENCH_COLUMNS)
+			continue;		// comments and anything else the serial capture picked up
+		r->known = 0;
+		for(int c = 0; c < BENCH_COLUMNS; c++)
+		{
+			if(strcmp(val[c], "-"))
+			{
+				r->val[c] = atof(val[c]);
+				r->known |= _BV(c);
+			}
+		}
+		r++;
+		n++;
+	}
+	fclose(fp);
+	return(n);
+}
+
+static int compare(double tolerance)
+{
+int regressions = 0;
+
+	for(int b = 0; b < nbaseline; b++)
+	{
+	struct result *base = &baseline[b], *cur = 0;
+
+		for(int n = 0; n < nresults; n++)
+			if(!strcmp(results[n].name, base->name))
+				cur = &results[n];
+		if(!cur)
+		{
+			printf("missing   %s\n", base->name);
+			continue;
+		}
+		for(int c = 1; c < BENCH_COLUMNS; c++)
+		{
+			if(!(base->known & cur->known & _BV(c)))
+				continue;
+			double delta = cur->val[c] - base->val[c];
+			if(delta < 0.05 && delta > -0.05)
+				continue;
+			if(delta > base->val[c] * tolerance)
+			{
+				printf("SLOWER    %-15s %-6s %9.1f -> %9.1f\n", base->name, column[c], base->val[c], cur->val[c]);
+				regressions++;
+			}
+			else if(-delta > base->val[c] * tolerance)
+				printf("faster    %-15s %-6s %9.1f -> %9.1f\n", base->name, column[c], base->val[c], cur->val[c]);
+		}
+	}
+	for(int n = 0; n < nresults; n++)
+	{
+		int b;
+		for(b = 0; b < nbaseline; b++)
+			if(!strcmp(results[n].name, baseline[b].name))
+				break;
+		if(b == nbaseline)
+			printf("new       %s\n", results[n].name);
+	}
+	printf("%d regression%s against the baseline\n", regressions, regressions == 1 ? "" : "s");
+	return(regressions != 0);
+}
+
+int main(int argc, char **argv)
+{
+double tolerance = 0.01;
+const char *basefile = 0;
+int arg = 1;
+
+	if(arg + 1 < argc && !strcmp(argv[arg], "-t"))
+	{
+		tolerance = atof(argv[arg + 1]) / 100;
+		arg += 2;
+	}
+	if(arg + 1 < argc && !strcmp(argv[arg], "-c"))
+	{
+		basefile = argv[arg + 1];
+		arg += 2;
+	}
+	if(arg < argc - 1 || (arg == argc - 1 && !basefile))
+	{
+		fprintf(stderr, "usage: bench [-t percent] [-c baseline [results]]\n");
+		return(2);
+	}
+
+	if(arg == argc - 1)
+		nresults = load(argv[arg], results);
+	else
+		run(basefile != 0);
+	if(!basefile)
+		return(0);
+	nbaseline = load(basefile, baseline);
+	return(compare(tolerance));
+}
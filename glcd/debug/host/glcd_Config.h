@@ -0,0 +1,148 @@
+/*
+ * glcd_Config.h - host simulator panel configurations
+ *
+ * vi:ts=4
+ *
+ * This file is part of the Arduino GLCD library host build.
+ * It replaces the library glcd_Config.h, the panel is selected with -DSIM_PANEL=n
+ * -DSIM_DUAL turns the ks0108 128x64 into two of them sharing the bus, each with its own
+ * chip selects.
+ * The ks0108 512x64 is 8 chips in a row on a 3 to 8 chip select decoder
+ * and needs wide (16 bit) coordinates.
+ * All panels share the data bus on pins 0-7 and DI/RW on pins 8/9.
+ */
+#ifndef glcd_CONFIG_H
+#define glcd_CONFIG_H
+
+#define SIM_KS0108		1
+#define SIM_KS0108_192	2
+#define SIM_SED1520		3
+#define SIM_MT12232D	4
+#define SIM_KS0713		5
+#define SIM_KS0108_512	6
+
+#ifndef SIM_PANEL
+#define SIM_PANEL SIM_KS0108
+#endif
+
+#define GLCD_NO_PRINTF
+
+#define glcdData0Pin 0
+#define glcdData1Pin 1
+#define glcdData2Pin 2
+#define glcdData3Pin 3
+#define glcdData4Pin 4
+#define glcdData5Pin 5
+#define glcdData6Pin 6
+#define glcdData7Pin 7
+#define glcdDI		8
+#define glcdRW		9
+
+#define GLCD_tDDR   320
+#define GLCD_tAS    140
+#define GLCD_tDSW   200
+#define GLCD_tWH    450
+#define GLCD_tWL    450
+
+#if SIM_PANEL == SIM_KS0108 || SIM_PANEL == SIM_KS0108_192 || SIM_PANEL == SIM_KS0108_512
+#define glcd_PanelConfigName "ks0108-sim"
+#if SIM_PANEL == SIM_KS0108
+#define DISPLAY_WIDTH 128
+#elif SIM_PANEL == SIM_KS0108_192
+#define DISPLAY_WIDTH 192
+#else
+#define DISPLAY_WIDTH 512
+#endif
+#define DISPLAY_HEIGHT 64
+#define CHIP_WIDTH 64
+#define CHIP_HEIGHT 64
+#define glcd_CHIP_COUNT (((DISPLAY_WIDTH + CHIP_WIDTH - 1)  / CHIP_WIDTH) * ((DISPLAY_HEIGHT + CHIP_HEIGHT -1) / CHIP_HEIGHT))
+#define glcdEN		10
+#define glcdCSEL1	11
+#define glcdCSEL2	12
+#if defined(SIM_DUAL) && glcd_CHIP_COUNT == 2
+#define glcd_PANEL_COUNT 2
+#define glcdCSEL3	13
+#define glcdCSEL4	14
+#define glcd_CHIP0 glcdCSEL1,HIGH, glcdCSEL2,LOW,  glcdCSEL3,LOW,  glcdCSEL4,LOW
+#define glcd_CHIP1 glcdCSEL1,LOW,  glcdCSEL2,HIGH, glcdCSEL3,LOW,  glcdCSEL4,LOW
+#define glcd_CHIP2 glcdCSEL1,LOW,  glcdCSEL2,LOW,  glcdCSEL3,HIGH, glcdCSEL4,LOW
+#define glcd_CHIP3 glcdCSEL1,LOW,  glcdCSEL2,LOW,  glcdCSEL3,LOW,  glcdCSEL4,HIGH
+#elif glcd_CHIP_COUNT == 8
+#define glcdCSEL3	13
+#define glcd_CHIP0 glcdCSEL1,LOW,  glcdCSEL2,LOW,  glcdCSEL3,LOW
+#define glcd_CHIP1 glcdCSEL1,HIGH, glcdCSEL2,LOW,  glcdCSEL3,LOW
+#define glcd_CHIP2 glcdCSEL1,LOW,  glcdCSEL2,HIGH, glcdCSEL3,LOW
+#define glcd_CHIP3 glcdCSEL1,HIGH, glcdCSEL2,HIGH, glcdCSEL3,LOW
+#define glcd_CHIP4 glcdCSEL1,LOW,  glcdCSEL2,LOW,  glcdCSEL3,HIGH
+#define glcd_CHIP5 glcdCSEL1,HIGH, glcdCSEL2,LOW,  glcdCSEL3,HIGH
+#define glcd_CHIP6 glcdCSEL1,LOW,  glcdCSEL2,HIGH, glcdCSEL3,HIGH
+#define glcd_CHIP7 glcdCSEL1,HIGH, glcdCSEL2,HIGH, glcdCSEL3,HIGH
+#elif glcd_CHIP_COUNT == 2
+#define glcd_CHIP0 glcdCSEL1,HIGH,   glcdCSEL2,LOW
+#define glcd_CHIP1 glcdCSEL1,LOW,    glcdCSEL2,HIGH
+#ifndef SIM_NOBCAST
+#define glcd_CHIPALL glcdCSEL1,HIGH, glcdCSEL2,HIGH
+#endif
+#else
+#define glcdCSEL3	13
+#define glcd_CHIP0  glcdCSEL1,HIGH, glcdCSEL2,LOW,  glcdCSEL3,LOW
+#define glcd_CHIP1  glcdCSEL1,LOW,  glcdCSEL2,HIGH, glcdCSEL3,LOW
+#define glcd_CHIP2  glcdCSEL1,LOW,  glcdCSEL2,LOW,  glcdCSEL3,HIGH
+#ifndef SIM_NOBCAST
+#define glcd_CHIPALL glcdCSEL1,HIGH, glcdCSEL2,HIGH, glcdCSEL3,HIGH
+#endif
+#endif
+#include "device/ks0108_Device.h"
+#define SIM_HWCOLS	64
+#define SIM_HWROWS	64
+#define SIM_ENPOL	1
+
+#elif SIM_PANEL == SIM_SED1520
+#define glcd_PanelConfigName "sed1520-sim"
+#define DISPLAY_WIDTH 120
+#define DISPLAY_HEIGHT 32
+#define CHIP_WIDTH 60
+#define CHIP_HEIGHT 32
+#define glcd_CHIP_COUNT 2
+#define glcdE1	14
+#define glcdE2	15
+#include "device/sed1520_Device.h"
+#define SIM_HWCOLS	80
+#define SIM_HWROWS	32
+#define SIM_ENPOL	1
+
+#elif SIM_PANEL == SIM_MT12232D
+#define glcd_PanelConfigName "mt12232d-sim"
+#define DISPLAY_WIDTH 122
+#define DISPLAY_HEIGHT 32
+#define CHIP_WIDTH 61
+#define CHIP_HEIGHT 32
+#define glcd_CHIP_COUNT 2
+#define glcdEN		10
+#define glcdCSEL1	11
+#define glcd_CHIP0 glcdCSEL1,HIGH
+#define glcd_CHIP1 glcdCSEL1,LOW
+#include "device/mt12232d_Device.h"
+#define SIM_HWCOLS	80
+#define SIM_HWROWS	32
+#define SIM_ENPOL	0
+
+#elif SIM_PANEL == SIM_KS0713
+#define glcd_PanelConfigName "ks0713-sim"
+#define DISPLAY_WIDTH 128
+#define DISPLAY_HEIGHT 64
+#define CHIP_WIDTH 128
+#define CHIP_HEIGHT 64
+#define glcd_CHIP_COUNT 1
+#define glcdEN		10
+#define GLCD_NOINIT_CHECKS
+#include "device/ks0713_Device.h"
+#define SIM_HWCOLS	132
+#define SIM_HWROWS	64
+#define SIM_ENPOL	1
+#endif
+
+#define glcd_PinConfigName "sim"
+
+#endif
@@ -0,0 +1,102 @@
+/*
+ * glcd_io_sim.h - glcd io primitives mapped onto the simulated panel
+ *
+ * vi:ts=4
+ *
+ * This file is part of the Arduino GLCD library host build.
+ *
+ * It is force included ahead of every library source (-include) and uses
+ * the same include guard as include/glcd_io.h so the AVR io layer is never
+ * pulled in. The device code sees the same lcdXXX() primitives it uses on
+ * the hardware, they just drive the model in glcd_sim.cpp.
+ */
+#ifndef GLCD_IO_H
+#define GLCD_IO_H
+
+#include "Arduino.h"
+
+void glcdsim_PinWrite(uint8_t pin, uint8_t val);
+void glcdsim_DataDir(uint8_t dir);
+void glcdsim_DataOut(uint8_t data);
+uint8_t glcdsim_DataIn(void);
+void glcdsim_Delay(double ns);
+
+#define lcdfastWrite(pin, pinval)	glcdsim_PinWrite(pin, pinval)
+void glcdsim_PinWrite2(uint8_t pin1, uint8_t val1, uint8_t pin2, uint8_t val2);
+#define lcdfastWrite2(p1, v1, p2, v2)	glcdsim_PinWrite2(p1, v1, p2, v2)
+#define lcdPinMode(pin, mode)
+#define lcdDataDir(dirbits)		glcdsim_DataDir(dirbits)
+#ifdef glcdSPI_LATCH
+/* shift register bus: 16 bits at 8Mhz SPI plus the latch pulse */
+#define lcdDataOut(data)		do { glcdsim_Delay(2125); glcdsim_DataOut(data); } while(0)
+#else
+#define lcdDataOut(data)		glcdsim_DataOut(data)
+#endif
+#define lcdDataIn()			glcdsim_DataIn()
+#define lcdRdBusystatus()		((glcdsim_DataIn() >> LCD_BUSY_BIT) & 1)
+#define lcdIsBusyStatus(status) (status & LCD_BUSY_FLAG)
+#define lcdIsResetStatus(status) (status & LCD_RESET_FLAG)
+
+#ifdef glcdRES
+#define lcdReset()		glcdsim_PinWrite(glcdRES, 0)
+#define lcdUnReset()	glcdsim_PinWrite(glcdRES, 1)
+#else
+#define lcdReset()
+#define lcdUnReset()
+#endif
+
+#define lcdDelayNanoseconds(__ns)	glcdsim_Delay(__ns)
+#define lcdDelayMilliseconds(__ms)	delay(__ms)
+
+/*
+ * simulated timer0 style tick counter (4us ticks like a 16Mhz AVR)
+ */
+#define SIM_TICKNS	4000
+uint8_t glcdsim_TimerTicks(void);
+#define lcdTimerTicks()		glcdsim_TimerTicks()
+#define lcdTimerTickNs		SIM_TICKNS
+
+/*
+ * chip select strings are pin,value pairs, the list is terminated
+ * with an impossible pin number.
+ */
+void glcdsim_ChipSelect(int pin, ...);
+#define lcdChipSelect(...) glcdsim_ChipSelect(__VA_ARGS__, -1)
+
+/*
+ * asynchronous flush: the timer interrupt is a real time SIGALRM
+ */
+#ifdef GLCD_ASYNC_FLUSH
+void glcdsim_AsyncInit(void);
+uint8_t glcdsim_IntSave(void);	// returns 1 if already masked
+void glcdsim_IntRestore(uint8_t s);
+#define lcdIntSave(s)		(s = glcdsim_IntSave())
+#define lcdIntRestore(s)	glcdsim_IntRestore(s)
+#define lcdAsyncTimerInit()	glcdsim_AsyncInit()
+#endif
+
+/*
+ * I2C port expander bus: the library's expander protocol
+ * drives a model of the MCP23017 register file,
+ * a byte that is not acknowledged is an error like on the TWI hardware
+ */
+#ifdef glcdI2C_ADDR
+uint8_t glcdsim_i2cStart(void);
+uint8_t glcdsim_i2cWrite(uint8_t b);
+void glcdsim_i2cStop(void);
+#define lcd_i2cInit()
+#define lcd_i2cStart()		do { if(!lcd_i2cerror && !glcdsim_i2cStart()) lcd_i2cerror = GLCD_EI2C; } while(0)
+#define lcd_i2cWrite(b)		do { if(!lcd_i2cerror && !glcdsim_i2cWrite(b)) lcd_i2cerror = GLCD_EI2C; } while(0)
+#define lcd_i2cStop()		do { if(!lcd_i2cerror) glcdsim_i2cStop(); } while(0)
+#include "glcd_Config.h"
+#include "include/mcp23017_io.h"
+#undef lcdChipSelect
+void glcdsim_ChipSelectI2C(int pin, ...);
+#define lcdChipSelect(...) glcdsim_ChipSelectI2C(__VA_ARGS__, -1)
+#endif
+
+#ifndef lcdBusEnd
+#define lcdBusEnd()
+#endif
+
+#endif
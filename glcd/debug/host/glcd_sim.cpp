@@ -0,0 +1,682 @@
+/*
+ * glcd_sim.cpp - in memory model of the glcd controller chips
+ *
+ * vi:ts=4
+ *
+ * This file is part of the Arduino GLCD library host build.
+ *
+ * The model tracks what the real controllers do with the bus:
+ * page/column registers, the read output latch that makes the
+ * dummy read necessary, column auto increment and wrap, busy status,
+ * display start line, read-modify-write mode and chip selects.
+ */
+
+#include <string.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include "Arduino.h"
+#include "glcd_Config.h"
+#include "glcd_sim.h"
+
+#define SIM_PAGES ((SIM_HWROWS+7)/8)
+
+/*
+ * every chip of every panel (-DSIM_DUAL), the panels are stacked in the image
+ */
+#ifndef glcd_PANEL_COUNT
+#define glcd_PANEL_COUNT	1
+#endif
+#define SIM_CHIPS	(glcd_CHIP_COUNT * glcd_PANEL_COUNT)
+#define SIM_IMGHEIGHT	(DISPLAY_HEIGHT * glcd_PANEL_COUNT)
+
+struct simchip
+{
+	uint8_t ram[SIM_PAGES][SIM_HWCOLS];
+	uint8_t page;
+	uint8_t col;
+	uint8_t start;
+	uint8_t on;
+	uint8_t latch;
+	uint8_t busy;
+	double busyuntil;
+	uint8_t rmw;
+	uint8_t rmwcol;
+};
+
+static struct simchip chips[SIM_CHIPS];
+static int enpin(int chip);
+static uint8_t pins[256];
+static uint8_t databus;
+static uint8_t datadir;
+static uint8_t busyreads;
+static uint8_t outchip;		// chip driving the bus on reads
+static double nanoseconds;
+static double simclock;		// never cleared, used for the time based busy model
+
+/*
+ * Busy model: by default a chip stays busy for busyreads status polls
+ * (SIM_STUCKBUSY polls means for ever, a dead chip).
+ * With SIM_TIMEDBUSY defined, a chip is busy for GLCD_tBUSY_DATA nanoseconds of
+ * simulated time after an operation (used to check the timed busy modes).
+ */
+#ifdef SIM_TIMEDBUSY
+#define SETBUSY(c)	((c)->busyuntil = simclock + GLCD_tBUSY_DATA)
+#define ISBUSY(c)	(simclock < (c)->busyuntil)
+#else
+#define SETBUSY(c)	((c)->busy = busyreads)
+#define ISBUSY(c)	((c)->busy)
+#endif
+static unsigned long msecs;
+
+struct glcdsim_counters glcdsim_count;
+
+void glcdsim_Reset(uint8_t nbusy)
+{
+	memset(chips, 0, sizeof(chips));
+	memset(pins, 0, sizeof(pins));
+	for(int c = 0; c < SIM_CHIPS; c++)
+	{
+		/*
+		 * Power up RAM contents are random, use a pattern
+		 */
+		for(int p = 0; p < SIM_PAGES; p++)
+			for(int x = 0; x < SIM_HWCOLS; x++)
+				chips[c].ram[p][x] = (uint8_t)(p * 37 + x * 11 + c);
+	}
+	for(int c = 0; c < SIM_CHIPS; c++)
+		pins[enpin(c)] = !SIM_ENPOL;
+	busyreads = nbusy;
+	glcdsim_ClearCounters();
+}
+
+void glcdsim_ClearCounters(void)
+{
+	memset(&glcdsim_count, 0, sizeof(glcdsim_count));
+	nanoseconds = 0;
+}
+
+double glcdsim_Nanoseconds(void)
+{
+	return(nanoseconds);
+}
+
+static int enpin(int chip)
+{
+#if SIM_PANEL == SIM_SED1520
+	return(chip ? glcdE2 : glcdE1);
+#else
+	(void) chip;
+	return(glcdEN);
+#endif
+}
+
+static int selected(int chip)
+{
+#if SIM_PANEL == SIM_KS0108 || SIM_PANEL == SIM_KS0108_192
+	return(pins[glcdCSEL1 + chip] == HIGH);
+#elif SIM_PANEL == SIM_KS0108_512
+	/*
+	 * 3 to 8 decoder, one chip selected at a time
+	 */
+	return(chip == (pins[glcdCSEL1] | (pins[glcdCSEL2] << 1) | (pins[glcdCSEL3] << 2)));
+#elif SIM_PANEL == SIM_MT12232D
+	return(pins[glcdCSEL1] == (chip ? LOW : HIGH));
+#else
+	(void) chip;
+	return(1);
+#endif
+}
+
+/*
+ * column registers can be loaded with values beyond the RAM
+ * (ks0713 loads them a nibble at a time), accesses wrap.
+ */
+static uint8_t *ramp(struct simchip *c)
+{
+	return(&c->ram[c->page][c->col % SIM_HWCOLS]);
+}
+
+static void bumpcol(struct simchip *c)
+{
+	if(++c->col >= SIM_HWCOLS)
+		c->col = 0;
+}
+
+static void command(struct simchip *c, uint8_t cmd)
+{
+	glcdsim_count.cmds++;
+#if SIM_PANEL == SIM_KS0108 || SIM_PANEL == SIM_KS0108_192 || SIM_PANEL == SIM_KS0108_512
+	if((cmd & 0xfe) == 0x3e)
+		c->on = cmd & 1;
+	else if((cmd & 0xc0) == 0xc0)
+	{
+		c->start = cmd & 0x3f;
+		glcdsim_count.startcmds++;
+	}
+	else if((cmd & 0xf8) == 0xb8)
+	{
+		c->page = cmd & 7;
+		glcdsim_count.pagecmds++;
+	}
+	else if((cmd & 0xc0) == 0x40)
+	{
+		c->col = cmd & 0x3f;
+		glcdsim_count.colcmds++;
+	}
+	else
+		glcdsim_count.violations++;
+#elif SIM_PANEL == SIM_SED1520 || SIM_PANEL == SIM_MT12232D
+	if((cmd & 0xfe) == 0xae)
+		c->on = cmd & 1;
+	else if((cmd & 0xe0) == 0xc0)
+	{
+		c->start = cmd & 0x1f;
+		glcdsim_count.startcmds++;
+	}
+	else if((cmd & 0xfc) == 0xb8)
+	{
+		c->page = cmd & 3;
+		glcdsim_count.pagecmds++;
+	}
+	else if(cmd < 0x50)
+	{
+		if(c->rmw)
+			glcdsim_count.violations++;	// can't set the column in RMW mode
+		c->col = cmd;
+		glcdsim_count.colcmds++;
+	}
+	else if(cmd == 0xe0)
+	{
+		c->rmw = 1;
+		c->rmwcol = c->col;
+	}
+	else if(cmd == 0xee)
+	{
+		if(c->rmw)
+			c->col = c->rmwcol;
+		c->rmw = 0;
+	}
+	else if(cmd == 0xe2)
+	{
+		c->start = 0;
+		c->page = 3;
+		c->col = 0;
+		c->rmw = 0;
+	}
+	/* ADC, static drive and duty are accepted and ignored */
+#elif SIM_PANEL == SIM_KS0713
+	if((cmd & 0xfe) == 0xae)
+		c->on = cmd & 1;
+	else if((cmd & 0xc0) == 0x40)
+	{
+		c->start = cmd & 0x3f;
+		glcdsim_count.startcmds++;
+	}
+	else if((cmd & 0xf0) == 0xb0)
+	{
+		c->page = cmd & 0xf;
+		glcdsim_count.pagecmds++;
+	}
+	else if((cmd & 0xf0) == 0x10)
+	{
+		if(c->rmw)
+			glcdsim_count.violations++;
+		c->col = (c->col & 0x0f) | ((cmd & 0xf) << 4);
+		glcdsim_count.colcmds++;
+	}
+	else if((cmd & 0xf0) == 0x00)
+	{
+		if(c->rmw)
+			glcdsim_count.violations++;
+		c->col = (c->col & 0xf0) | (cmd & 0xf);
+		glcdsim_count.colcmds++;
+	}
+	else if(cmd == 0xe0)
+	{
+		c->rmw = 1;
+		c->rmwcol = c->col;
+	}
+	else if(cmd == 0xee)
+	{
+		if(c->rmw)
+			c->col = c->rmwcol;
+		c->rmw = 0;
+	}
+#endif
+	if(c->page >= SIM_PAGES)
+		c->page = SIM_PAGES-1;
+	SETBUSY(c);
+}
+
+static uint8_t status(struct simchip *c)
+{
+uint8_t s = 0;
+	if(ISBUSY(c))
+		s |= 0x80;
+	if(!c->on)
+		s |= 0x20;
+	return(s);
+}
+
+/*
+ * active edge of an enable
+ */
+static void enable_on(int ch)
+{
+	glcdsim_count.strobes++;
+	if(pins[glcdRW] == HIGH)
+	{
+		int n = 0;
+		for(int c = 0; c < SIM_CHIPS; c++)
+		{
+			if(enpin(c) == ch && selected(c))
+			{
+				n++;
+				outchip = c;
+			}
+		}
+		if(n != 1)	// nobody or more than one chip driving the bus
+			glcdsim_count.violations++;
+		if(datadir != 0)
+			glcdsim_count.violations++;
+		if(pins[glcdDI] == LOW)
+			glcdsim_count.status++;
+		else
+		{
+			glcdsim_count.reads++;
+			if(ISBUSY(&chips[outchip]))
+				glcdsim_count.violations++;
+		}
+	}
+}
+
+/*
+ * what a chip does at the end of an access
+ */
+static void access(struct simchip *chip)
+{
+	if(pins[glcdRW] == LOW)
+	{
+		if(pins[glcdDI] == LOW)
+			command(chip, databus);
+		else
+		{
+			glcdsim_count.writes++;
+			*ramp(chip) = databus;
+			bumpcol(chip);
+			SETBUSY(chip);
+		}
+	}
+	else if(pins[glcdDI] == HIGH)
+	{
+		chip->latch = *ramp(chip);
+		if(!chip->rmw)
+			bumpcol(chip);
+	}
+}
+
+/*
+ * inactive edge of an enable
+ */
+static void enable_off(int ch)
+{
+	for(int c = 0; c < SIM_CHIPS; c++)
+	{
+		if(enpin(c) != ch || !selected(c))
+			continue;
+		struct simchip *chip = &chips[c];
+
+		if(pins[glcdRW] == LOW)
+		{
+			if(datadir != 0xff)
+				glcdsim_count.violations++;
+			if(ISBUSY(chip))
+				glcdsim_count.violations++;
+		}
+		access(chip);
+	}
+}
+
+/*
+ * apply a bus transaction straight to a chip (or all of them)
+ * without going through the pins, used to replay bus traces.
+ * Returns what a read would have returned.
+ */
+uint8_t glcdsim_Transaction(uint8_t chip, uint8_t di, uint8_t rw, uint8_t data)
+{
+uint8_t ret = 0;
+
+	pins[glcdDI] = di;
+	pins[glcdRW] = rw;
+	databus = data;
+	for(int c = 0; c < SIM_CHIPS; c++)
+	{
+		if(chip != c && chip < SIM_CHIPS)
+			continue;
+		if(rw == HIGH)
+		{
+			ret = (di == LOW) ? status(&chips[c]) : chips[c].latch;
+			if(di == HIGH)
+				glcdsim_count.reads++;
+			else
+				glcdsim_count.status++;
+		}
+		access(&chips[c]);
+	}
+	return(ret);
+}
+
+void glcdsim_ChipRegs(uint8_t chip, struct glcdsim_regs *regs)
+{
+struct simchip *c = &chips[chip];
+
+	regs->page = c->page;
+	regs->col = c->col;
+	regs->start = c->start;
+	regs->rmw = c->rmw;
+	regs->data = *ramp(c);
+}
+
+void glcdsim_PinWrite(uint8_t pin, uint8_t val)
+{
+	val = val ? HIGH : LOW;
+	if(pin == glcdDI || pin == glcdRW)
+		glcdsim_count.ctlops++;
+	if(pins[pin] == val)
+		return;
+	pins[pin] = val;
+	for(int c = 0; c < SIM_CHIPS; c++)
+	{
+		if(enpin(c) == pin)
+		{
+			if(val == SIM_ENPOL)
+				enable_on(pin);
+			else
+				enable_off(pin);
+			break;
+		}
+	}
+}
+
+void glcdsim_ChipSelect(int pin, ...)
+{
+va_list ap;
+
+	va_start(ap, pin);
+	while(pin >= 0)
+	{
+		int val = va_arg(ap, int);
+		glcdsim_PinWrite(pin, val);
+		pin = va_arg(ap, int);
+	}
+	va_end(ap);
+}
+
+void glcdsim_PinWrite2(uint8_t pin1, uint8_t val1, uint8_t pin2, uint8_t val2)
+{
+	glcdsim_PinWrite(pin1, val1);
+	glcdsim_PinWrite(pin2, val2);
+	glcdsim_count.ctlops--;	// merged port write counts as one
+}
+
+void glcdsim_DataDir(uint8_t dir)
+{
+	glcdsim_count.ctlops++;
+	datadir = dir;
+}
+
+void glcdsim_DataOut(uint8_t data)
+{
+	databus = data;
+}
+
+uint8_t glcdsim_DataIn(void)
+{
+struct simchip *c = &chips[outchip];
+
+	if(pins[glcdDI] == LOW)
+	{
+		uint8_t s = status(c);
+		if(ISBUSY(c))
+		{
+			glcdsim_count.busypolls++;
+#ifdef SIM_TIMEDBUSY
+			simclock += 250;	// a status poll takes time
+#else
+			if(busyreads != SIM_STUCKBUSY)
+				c->busy--;
+#endif
+		}
+		return(s);
+	}
+	return(c->latch);
+}
+
+void glcdsim_Delay(double ns)
+{
+	nanoseconds += ns;
+	simclock += ns;
+}
+
+uint8_t glcdsim_TimerTicks(void)
+{
+	return((uint8_t)(unsigned long)(simclock / SIM_TICKNS));
+}
+
+uint8_t glcdsim_Pixel(uint16_t x, uint16_t y)
+{
+uint8_t chip, col, row, panel;
+
+	panel = y / DISPLAY_HEIGHT;
+	y %= DISPLAY_HEIGHT;
+	chip = glcd_DevXYval2Chip(x, y) + panel * glcd_CHIP_COUNT;
+	col = glcd_DevXval2ChipCol(x);
+	row = ((y % CHIP_HEIGHT) + chips[chip].start) % SIM_HWROWS;
+	return((chips[chip].ram[row/8][col] >> (row & 7)) & 1);
+}
+
+void glcdsim_DumpImage(FILE *fp)
+{
+	for(int y = 0; y < SIM_IMGHEIGHT; y++)
+	{
+		for(int x = 0; x < DISPLAY_WIDTH; x++)
+			fputc(glcdsim_Pixel(x, y) ? '#' : '.', fp);
+		fputc('\n', fp);
+	}
+}
+
+unsigned long glcdsim_ImageHash(void)
+{
+unsigned long h = 5381;
+	for(int y = 0; y < SIM_IMGHEIGHT; y++)
+		for(int x = 0; x < DISPLAY_WIDTH; x++)
+			h = h * 33 + glcdsim_Pixel(x, y);
+	return(h);
+}
+
+/*
+ * Arduino core stand ins
+ */
+void delay(unsigned long ms)
+{
+	msecs += ms;
+	nanoseconds += ms * 1e6;
+	simclock += ms * 1e6;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+	nanoseconds += us * 1e3;
+	simclock += us * 1e3;
+}
+
+unsigned long millis(void)
+{
+	return(msecs + (unsigned long)(nanoseconds / 1e6));
+}
+
+unsigned long micros(void)
+{
+	return((unsigned long)(nanoseconds / 1e3));
+}
+
+#ifdef GLCD_ASYNC_FLUSH
+/*
+ * The flush timer interrupt is a real time SIGALRM,
+ * masking it stands in for clearing the AVR interrupt flag.
+ */
+#include <signal.h>
+#include <sys/time.h>
+
+void glcd_FlushISR(void);
+
+static void sim_alarm(int sig)
+{
+	(void) sig;
+	glcdsim_count.isrs++;
+	glcd_FlushISR();
+}
+
+uint8_t glcdsim_IntSave(void)
+{
+sigset_t m, o;
+
+	sigemptyset(&m);
+	sigaddset(&m, SIGALRM);
+	sigprocmask(SIG_BLOCK, &m, &o);
+	return(sigismember(&o, SIGALRM));
+}
+
+void glcdsim_IntRestore(uint8_t s)
+{
+sigset_t m;
+
+	sigemptyset(&m);
+	sigaddset(&m, SIGALRM);
+	if(!s)
+		sigprocmask(SIG_UNBLOCK, &m, 0);
+}
+
+void glcdsim_AsyncInit(void)
+{
+struct sigaction sa;
+struct itimerval it = {{0, 20}, {0, 20}};
+
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = sim_alarm;
+	sigaction(SIGALRM, &sa, 0);
+	setitimer(ITIMER_REAL, &it, 0);
+}
+#endif
+
+#ifdef glcdI2C_ADDR
+/*
+ * MCP23017 register file model (IOCON.BANK = 0)
+ * port A drives the data bus, port B bit n drives sim pin 8+n
+ * A strobe changing together with other control lines is a violation.
+ */
+static uint8_t mcp_regs[0x16] = {0xff, 0xff};
+static uint8_t mcp_ptr;
+static int mcp_state;
+#if defined(glcdEN)
+#define MCP_STROBES	_BV(glcdEN & 7)
+#else
+#define MCP_STROBES	(_BV(glcdE1 & 7) | _BV(glcdE2 & 7))
+#endif
+
+static void mcp_drive(void)
+{
+	glcdsim_DataDir(~mcp_regs[0x00]);
+	if(mcp_regs[0x00] == 0)
+		glcdsim_DataOut(mcp_regs[0x14]);
+	uint8_t b = mcp_regs[0x15] & ~mcp_regs[0x01];
+	static uint8_t last = 0x55;
+	if(mcp_regs[0x01] == 0xff)
+		return;
+	if(last != 0x55 && ((last ^ b) & MCP_STROBES) && ((last ^ b) & ~MCP_STROBES))
+		glcdsim_count.violations++;
+	for(int pass = 0; pass < 2; pass++)
+	{
+		for(int n = 0; n < 8; n++)
+		{
+			if(!!(MCP_STROBES & _BV(n)) != pass)
+				continue;
+			if(last == 0x55 || ((last ^ b) & _BV(n)))
+				glcdsim_PinWrite(8 + n, (b >> n) & 1);
+		}
+	}
+	last = b;
+}
+
+/*
+ * returns 0 when the start or byte fails (not acknowledged)
+ * With -DSIM_I2C_NOACK=n the expander stops answering after n bytes
+ * (0 is no expander at all), like a cable coming loose.
+ */
+uint8_t glcdsim_i2cStart(void)
+{
+	glcdsim_Delay(2500);
+	mcp_state = 1;
+	glcdsim_count.i2cxfers++;
+	return(1);
+}
+
+uint8_t glcdsim_i2cWrite(uint8_t b)
+{
+	glcdsim_Delay(22500);	// 9 bits at 400Khz
+#ifdef SIM_I2C_NOACK
+	static unsigned long acked;
+
+	if(acked >= SIM_I2C_NOACK)
+		return(0);
+	acked++;
+#endif
+	glcdsim_count.i2cbytes++;
+	switch(mcp_state)
+	{
+	case 1:
+		if(b != (glcdI2C_ADDR << 1))
+			glcdsim_count.violations++;
+		mcp_state = 2;
+		break;
+	case 2:
+		mcp_ptr = b;
+		mcp_state = 3;
+		break;
+	case 3:
+		if(mcp_ptr < sizeof(mcp_regs))
+			mcp_regs[mcp_ptr] = b;
+		if(mcp_ptr <= 0x01 || mcp_ptr >= 0x12)
+			mcp_drive();
+		if(mcp_regs[0x0a] & 0x20)
+			mcp_ptr ^= 1;
+		else if(++mcp_ptr >= sizeof(mcp_regs))
+			mcp_ptr = 0;
+		break;
+	default:
+		glcdsim_count.violations++;	// no start
+	}
+	return(1);
+}
+
+void glcdsim_i2cStop(void)
+{
+	glcdsim_Delay(2500);
+	mcp_state = 0;
+}
+
+void glcdsim_ChipSelectI2C(int pin, ...)
+{
+va_list ap;
+
+	va_start(ap, pin);
+	while(pin >= 0)
+	{
+		int val = va_arg(ap, int);
+		lcdfastWrite(pin, val);
+		pin = va_arg(ap, int);
+	}
+	va_end(ap);
+}
+
+#endif
@@ -0,0 +1,54 @@
+/*
+ * glcd_sim.h - in memory model of the glcd controller chips
+ *
+ * vi:ts=4
+ *
+ * This file is part of the Arduino GLCD library host build.
+ */
+#ifndef GLCD_SIM_H
+#define GLCD_SIM_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+struct glcdsim_counters
+{
+	unsigned long cmds;			// all commands
+	unsigned long pagecmds;		// set page commands
+	unsigned long colcmds;		// set column commands (lo/hi nibble counts as one each)
+	unsigned long startcmds;	// display start line commands
+	unsigned long writes;		// data writes
+	unsigned long reads;		// data reads (dummy reads included)
+	unsigned long status;		// status reads (one per strobe)
+	unsigned long busypolls;	// status samples taken while busy
+	unsigned long strobes;		// EN strobes of any kind
+	unsigned long violations;	// bus protocol errors
+	unsigned long ctlops;		// data direction and DI/RW port operations
+	unsigned long i2cxfers;		// I2C transfers (expander bus)
+	unsigned long i2cbytes;		// I2C bytes (expander bus)
+	unsigned long isrs;			// flush timer interrupts (async flush)
+};
+
+extern struct glcdsim_counters glcdsim_count;
+
+struct glcdsim_regs
+{
+	uint8_t page;
+	uint8_t col;
+	uint8_t start;
+	uint8_t rmw;
+	uint8_t data;				// display memory at page/col
+};
+
+#define SIM_STUCKBUSY	255		// glcdsim_Reset() busyreads for chips that never come ready
+
+void glcdsim_Reset(uint8_t busyreads);
+void glcdsim_ClearCounters(void);
+uint8_t glcdsim_Pixel(uint16_t x, uint16_t y);	// panels are stacked, y of panel n starts at n * DISPLAY_HEIGHT
+void glcdsim_DumpImage(FILE *fp);
+unsigned long glcdsim_ImageHash(void);
+double glcdsim_Nanoseconds(void);
+uint8_t glcdsim_Transaction(uint8_t chip, uint8_t di, uint8_t rw, uint8_t data);
+void glcdsim_ChipRegs(uint8_t chip, struct glcdsim_regs *regs);
+
+#endif
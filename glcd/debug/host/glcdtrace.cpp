@@ -0,0 +1,264 @@
+/*
+ * glcdtrace.cpp - replay a glcd bus trace into the panel model and report on it
+ *
+ * vi:ts=4
+ *
+ * This file is part of the Arduino GLCD library host build.
+ *
+ * The trace is what GLCD.TraceDump() sends with GLCD_BUS_TRACE turned on
+ * (see include/glcd_trace.h). It must be built for the same panel (PANEL=n)
+ * as the trace was recorded on.
+ *
+ * usage: glcdtrace [-i imagefile] tracefile
+ *
+ * One line is printed for the transactions before the first mark,
+ * one for each GLCD.TraceMark() and one for the whole trace, followed
+ * by the bus accesses per chip and LCD page.
+ *
+ * redund	commands that set a page, column or start line register to the value
+ *			it already had, or that were replaced by another before being used
+ * same		data writes of the byte display memory already had
+ * rd/wr	data reads (dummy reads included) per data write
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "Arduino.h"
+#include "glcd_Config.h"
+#include "include/glcd_trace.h"
+#include "glcd_sim.h"
+
+#ifndef glcd_PANEL_COUNT
+#define glcd_PANEL_COUNT	1
+#endif
+#define SIM_CHIPS	(glcd_CHIP_COUNT * glcd_PANEL_COUNT)
+#define SIM_PAGES	((DISPLAY_HEIGHT + 7) / 8)
+
+struct stats
+{
+	unsigned long cmds, pagecmds, colcmds, startcmds;
+	unsigned long redundant;
+	unsigned long writes, same;
+	unsigned long reads, status;
+};
+
+static struct stats seg, total;
+static unsigned long chipcount[SIM_CHIPS][4];	// cmds, writes, reads, status
+static unsigned long pagecount[SIM_CHIPS][SIM_PAGES];
+static uint8_t pending[SIM_CHIPS];				// address registers set but not used yet
+
+#define PEND_PAGE	1
+#define PEND_COL	2
+#define PEND_COLHI	4
+
+/*
+ * column addresses sent a nibble at a time are two separate registers
+ */
+#ifdef LCD_SET_ADDLO
+#define PEND_COLCMD(cmd)	(((cmd) & LCD_SET_ADDHI) ? PEND_COLHI : PEND_COL)
+#else
+#define PEND_COLCMD(cmd)	PEND_COL
+#endif
+
+static void header(void)
+{
+	printf("%-10s %7s %6s %6s %6s %6s %7s %7s %6s %7s %7s %6s %s\n",
+		"segment", "cmds", "page", "col", "start", "other", "redund",
+		"writes", "same", "reads", "status", "rd/wr", "hash");
+}
+
+static void report(const char *name, struct stats *s)
+{
+	printf("%-10s %7lu %6lu %6lu %6lu %6lu %7lu %7lu %6lu %7lu %7lu %6.2f %08lx\n",
+		name, s->cmds, s->pagecmds, s->colcmds, s->startcmds,
+		s->cmds - s->pagecmds - s->colcmds - s->startcmds, s->redundant,
+		s->writes, s->same, s->reads, s->status,
+		s->writes ? (double) s->reads / s->writes : 0.0,
+		glcdsim_ImageHash() & 0xffffffffUL);
+}
+
+static void add(struct stats *to, struct stats *s)
+{
+	to->cmds += s->cmds;
+	to->pagecmds += s->pagecmds;
+	to->colcmds += s->colcmds;
+	to->startcmds += s->startcmds;
+	to->redundant += s->redundant;
+	to->writes += s->writes;
+	to->same += s->same;
+	to->reads += s->reads;
+	to->status += s->status;
+}
+
+/*
+ * a command to one chip
+ */
+static void command(uint8_t chip, uint8_t cmd)
+{
+struct glcdsim_regs before, after;
+struct glcdsim_counters cnt = glcdsim_count;
+
+	glcdsim_ChipRegs(chip, &before);
+	glcdsim_Transaction(chip, LOW, LOW, cmd);
+	glcdsim_ChipRegs(chip, &after);
+
+	seg.cmds++;
+	chipcount[chip][0]++;
+	if(glcdsim_count.pagecmds != cnt.pagecmds)
+	{
+		seg.pagecmds++;
+		if(after.page == before.page || (pending[chip] & PEND_PAGE))
+			seg.redundant++;
+		pending[chip] |= PEND_PAGE;
+	}
+	else if(glcdsim_count.colcmds != cnt.colcmds)
+	{
+		seg.colcmds++;
+		if(after.col == before.col || (pending[chip] & PEND_COLCMD(cmd)))
+			seg.redundant++;
+		pending[chip] |= PEND_COLCMD(cmd);
+	}
+	else if(glcdsim_count.startcmds != cnt.startcmds)
+	{
+		seg.startcmds++;
+		if(after.start == before.start)
+			seg.redundant++;
+	}
+}
+
+/*
+ * a data read or write on one chip
+ */
+static uint8_t access(uint8_t chip, uint8_t rw, uint8_t data)
+{
+struct glcdsim_regs regs;
+
+	glcdsim_ChipRegs(chip, &regs);
+	glcdsim_Transaction(chip, HIGH, rw, data);
+	pending[chip] = 0;
+	pagecount[chip][regs.page % SIM_PAGES]++;
+	if(rw == LOW)
+	{
+		chipcount[chip][1]++;
+		return(regs.data == data);
+	}
+	chipcount[chip][2]++;
+	return(0);
+}
+
+static void replay(uint8_t rec, uint8_t data)
+{
+uint8_t chip = GLCD_TRACE_CHIP(rec);
+uint8_t first = chip, last = chip, same = 1;
+
+	if(chip == GLCD_TRACE_ALLCHIPS)
+	{
+		first = 0;
+		last = SIM_CHIPS - 1;
+	}
+	else if(chip >= SIM_CHIPS)
+	{
+		fprintf(stderr, "glcdtrace: chip %d in the trace, the panel only has %d\n", chip, SIM_CHIPS);
+		exit(1);
+	}
+
+	switch(GLCD_TRACE_TYPE(rec))
+	{
+	case GLCD_TRACE_CMD:
+		for(chip = first; chip <= last; chip++)
+			command(chip, data);
+		break;
+	case GLCD_TRACE_WRITE:
+		for(chip = first; chip <= last; chip++)
+			same &= access(chip, LOW, data);
+		seg.writes++;
+		seg.same += same;
+		break;
+	case GLCD_TRACE_READ:
+		for(chip = first; chip <= last; chip++)
+			access(chip, HIGH, data);
+		seg.reads++;
+		break;
+	case GLCD_TRACE_STATUS:
+		for(chip = first; chip <= last; chip++)
+		{
+			glcdsim_Transaction(chip, LOW, HIGH, 0);
+			chipcount[chip][3]++;
+		}
+		seg.status++;
+		break;
+	}
+}
+
+int main(int argc, char **argv)
+{
+FILE *fp, *img = 0;
+int rec, data;
+char name[16] = "start";
+int arg = 1;
+
+	if(arg + 1 < argc && !strcmp(argv[arg], "-i"))
+	{
+		if(!(img = fopen(argv[arg + 1], "w")))
+		{
+			perror(argv[arg + 1]);
+			return(1);
+		}
+		arg += 2;
+	}
+	if(arg + 1 != argc)
+	{
+		fprintf(stderr, "usage: glcdtrace [-i imagefile] tracefile\n");
+		return(1);
+	}
+	if(!(fp = fopen(argv[arg], "rb")))
+	{
+		perror(argv[arg]);
+		return(1);
+	}
+
+	glcdsim_Reset(0);	// a recorded trace already waited for the chips
+	header();
+	while((rec = getc(fp)) != EOF && (data = getc(fp)) != EOF)
+	{
+		switch(GLCD_TRACE_TYPE(rec))
+		{
+		case GLCD_TRACE_MARK:
+			report(name, &seg);
+			add(&total, &seg);
+			memset(&seg, 0, sizeof(seg));
+			snprintf(name, sizeof(name), "mark %d", data);
+			break;
+		case GLCD_TRACE_LOST:
+			printf("** %d%s records lost, the image can be wrong **\n", data, data == 255 ? " or more" : "");
+			break;
+		default:
+			replay(rec, data);
+		}
+	}
+	fclose(fp);
+	report(name, &seg);
+	add(&total, &seg);
+	report("total", &total);
+
+	printf("\n%-6s %8s %8s %8s %8s", "chip", "cmds", "writes", "reads", "status");
+	for(int page = 0; page < SIM_PAGES; page++)
+		printf("  page%-2d", page);
+	printf("\n");
+	for(int chip = 0; chip < SIM_CHIPS; chip++)
+	{
+		printf("%-6d %8lu %8lu %8lu %8lu", chip,
+			chipcount[chip][0], chipcount[chip][1], chipcount[chip][2], chipcount[chip][3]);
+		for(int page = 0; page < SIM_PAGES; page++)
+			printf(" %7lu", pagecount[chip][page]);
+		printf("\n");
+	}
+
+	if(img)
+	{
+		glcdsim_DumpImage(img);
+		fclose(img);
+	}
+	return(0);
+}
@@ -0,0 +1,297 @@
+/*
+ * scene.cpp - draw a fixed scene and report image hashes and bus counts per step
+ *
+ * vi:ts=4
+ *
+ * This file is part of the Arduino GLCD library host build.
+ *
+ * Each step prints one line: the step name, a hash of the panel image
+ * and the bus operations and simulated bus time the step took.
+ * Identical hashes across builds mean identical images.
+ * With several panels (-DSIM_DUAL) the hash and image cover all of them.
+ * If a file name is given, the panel image is also dumped to it after each step.
+ * With GLCD_BUS_TRACE a second file name gets the bus trace, with a
+ * GLCD.TraceMark() at the start of each step (mark n is the nth line).
+ * With GLCD_STATS the line ends with the library's own counters (GLCD.GetStats()),
+ * they should agree with the model's (commands and writes to all chips at once
+ * count once in the library and once per chip in the model).
+ * With GLCD_PAGE_CACHE or GLCD_RLE_CACHE they are followed by the cache hits/misses/evictions.
+ * With GLCD_PAGE_BAND only the "picture" step is drawn, one band at a time,
+ * its hash should match the "picture" step of the other builds.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "glcd.h"
+#include "glcd_sim.h"
+#include "fonts/SystemFont5x7.h"
+#include "fonts/Arial14.h"
+#include "fonts/fixednums8x16.h"
+#include "bitmaps/ArduinoIcon32x32.h"
+
+/*
+ * status polls each chip stays busy for after every access,
+ * 0 is a fast controller, SIM_STUCKBUSY a dead one
+ */
+#ifndef SIM_BUSYREADS
+#define SIM_BUSYREADS	1
+#endif
+
+static FILE *img;
+
+#ifdef GLCD_BUS_TRACE
+class FilePrint : public Print
+{
+  public:
+	FILE *fp;
+	size_t write(uint8_t c) { if(fp) putc(c, fp); return(1); }
+};
+static FilePrint trace;
+static uint8_t stepno;
+#endif
+
+static void step(const char *name)
+{
+	GLCD.Flush();		// nothing to do without the write back cache
+	printf("%-14s hash=%08lx cmds=%lu page=%lu col=%lu wr=%lu rd=%lu st=%lu busy=%lu viol=%lu ctl=%lu stb=%lu us=%.0f",
+		name, glcdsim_ImageHash() & 0xffffffffUL, glcdsim_count.cmds, glcdsim_count.pagecmds,
+		glcdsim_count.colcmds, glcdsim_count.writes, glcdsim_count.reads,
+		glcdsim_count.status, glcdsim_count.busypolls, glcdsim_count.violations, glcdsim_count.ctlops, glcdsim_count.strobes, glcdsim_Nanoseconds()/1000);
+#ifdef glcdI2C_ADDR
+	printf(" i2cxfers=%lu i2cbytes=%lu", glcdsim_count.i2cxfers, glcdsim_count.i2cbytes);
+#endif
+#ifdef GLCD_ASYNC_FLUSH
+	printf(" isrs=%lu", glcdsim_count.isrs);
+#endif
+	uint8_t error = GLCD.GetError();
+	if(error)
+		printf(" error=%d", error);
+#ifdef GLCD_STATS
+	glcdStats_t stats = GLCD.GetStats();
+	printf(" stats=%lu/%lu/%lu/%lu/%lu/%lu/%lu/%lu/%lu",
+		(unsigned long) stats.cmds, (unsigned long) stats.pagecmds, (unsigned long) stats.colcmds,
+		(unsigned long) stats.reads, (unsigned long) stats.dummyreads, (unsigned long) stats.writes,
+		(unsigned long) stats.unaligned, (unsigned long) stats.chipswitches, (unsigned long) stats.busypolls);
+#if defined(GLCD_PAGE_CACHE) || defined(GLCD_RLE_CACHE)
+	printf(" cache=%lu/%lu/%lu", (unsigned long) stats.cachehits, (unsigned long) stats.cachemisses,
+		(unsigned long) stats.cacheevictions);
+#endif
+	GLCD.ResetStats();
+#endif
+	printf("\n");
+	if(img)
+	{
+		fprintf(img, "== %s\n", name);
+		glcdsim_DumpImage(img);
+	}
+#ifdef GLCD_BUS_TRACE
+	GLCD.TraceDump(trace);
+	GLCD.TraceMark(++stepno);
+#endif
+	glcdsim_ClearCounters();
+}
+
+/*
+ * a picture that crosses pages and chips, drawn the same way
+ * with and without the page band
+ */
+static void picture(void)
+{
+	GLCD.DrawRoundRect(0, 0, GLCD.Width-1, GLCD.Height-1, 6);
+	GLCD.FillRect(GLCD.CenterX - 30, 10, 60, 17);
+	GLCD.InvertRect(GLCD.CenterX - 40, 5, 30, 30);
+	GLCD.DrawLine(2, GLCD.Bottom - 2, GLCD.Right - 2, 2);
+	GLCD.FillCircle(GLCD.Right - 16, GLCD.CenterY, 11);
+	GLCD.DrawCircle(GLCD.Right - 16, GLCD.CenterY, 13);
+	GLCD.DrawBitmap(ArduinoIcon32x32, 6, 13);
+	GLCD.DrawBitmap(ArduinoIcon32x32, GLCD.CenterX - 8, GLCD.Bottom - 35, WHITE);
+	GLCD.SelectFont(System5x7);
+	GLCD.CursorTo(1, 1);
+	GLCD.print("Band 123");
+	GLCD.CursorToXY(GLCD.CenterX - 12, GLCD.Bottom - 17);
+	GLCD.print("xy");
+}
+
+int main(int argc, char **argv)
+{
+	if(argc > 1)
+		img = fopen(argv[1], "w");
+#ifdef GLCD_BUS_TRACE
+	if(argc > 2)
+		trace.fp = fopen(argv[2], "wb");
+	GLCD.TraceMark(0);
+#endif
+	glcdsim_Reset(SIM_BUSYREADS);
+	int status = GLCD.Init();
+	printf("init status %d\n", status);
+	step("init");
+
+#ifdef GLCD_PAGE_BAND
+	GLCD.FirstBand();
+	do
+	{
+		picture();
+	} while(GLCD.NextBand());
+	step("picture");
+	if(img)
+		fclose(img);
+	return(0);
+#endif
+
+	GLCD.ClearScreen(BLACK);
+	step("clearblack");
+	GLCD.ClearScreen();
+	step("clear");
+
+	GLCD.DrawRect(1, 1, GLCD.Width-3, GLCD.Height-3);
+	step("rect");
+	GLCD.DrawRoundRect(5, 3, 40, 20, 5);
+	step("roundrect");
+	GLCD.FillRect(50, 5, 30, 13);
+	step("fillrect");
+	GLCD.FillRect(52, 7, 10, 3, WHITE);
+	step("fillrectw");
+	GLCD.InvertRect(45, 2, 50, 21);
+	step("invertrect");
+	for(int i = 0; i < 8; i++)
+		GLCD.DrawLine(GLCD.CenterX, GLCD.CenterY, (i & 1) ? 0 : GLCD.Right, (i & 2) ? 3 : GLCD.Bottom - 2*i);
+	GLCD.DrawLine(0, 0, GLCD.Right, GLCD.Bottom);
+	GLCD.DrawLine(GLCD.Right, 0, 0, GLCD.Bottom, WHITE);
+	step("lines");
+	GLCD.DrawCircle(GLCD.CenterX, GLCD.CenterY, 12);
+	GLCD.FillCircle(20, GLCD.CenterY, 9);
+	step("circles");
+	for(uint8_t y = 0; y < 8; y++)
+		GLCD.DrawBitmap(ArduinoIcon32x32, 2 + y * 11, y);
+	step("bitmaps");
+	GLCD.ClearScreen();
+	GLCD.DrawBitmap(ArduinoIcon32x32, 60, 0);
+	GLCD.DrawBitmap(ArduinoIcon32x32, 90, 0, WHITE);
+	step("bitmaps2");
+	for(glcdCoord_t x = 0; x < GLCD.Width; x += 3)
+		GLCD.SetDot(x, (x * 7) % GLCD.Height, BLACK);
+	step("dots");
+	GLCD.DrawVLine(GLCD.Right, 0, GLCD.Bottom);
+	GLCD.DrawHLine(0, GLCD.Bottom, GLCD.Right);
+	step("hvlines");
+
+	GLCD.ClearScreen();
+	GLCD.SelectFont(System5x7);
+	for(int i = 0; i < 20; i++)
+	{
+		GLCD.print("Line ");
+		GLCD.println(i);
+	}
+	step("textscroll");
+
+	gText t1(textAreaTOPLEFT);
+	t1.SelectFont(Arial14);
+	t1.ClearArea();
+	for(int i = 0; i < 10; i++)
+		t1.println("Arial Text");
+	step("arialscroll");
+
+	gText t2(textAreaBOTTOMRIGHT, SCROLL_DOWN);
+	t2.SelectFont(System5x7, WHITE);
+	t2.ClearArea();
+	for(int i = 0; i < 12; i++)
+	{
+		t2.print("dn ");
+		t2.println(i);
+	}
+	step("scrolldown");
+
+	gText t3(GLCD.CenterX - 20, 3, GLCD.CenterX + 20, GLCD.Bottom - 3);
+	t3.SelectFont(fixednums8x16);
+	t3.ClearArea();
+	t3.print("123456");
+	step("bignums");
+
+	GLCD.SetDisplayMode(INVERTED);
+	step("inverted");
+	GLCD.SelectFont(System5x7);
+	GLCD.CursorTo(0, 0);
+	GLCD.print("Inverted text");
+	GLCD.EraseTextLine(1);
+	GLCD.FillRect(3, 40 % GLCD.Height, 20, 5);
+	step("invdraw");
+	GLCD.SetDisplayMode(NON_INVERTED);
+	step("normal");
+
+	GLCD.ClearScreen();
+	gText full(textAreaFULL);
+	full.SelectFont(System5x7);
+	for(int i = 0; i < 40; i++)
+	{
+		full.print("log ");
+		full.println(i);
+	}
+	step("fullscroll");
+
+	gText fulldn(textAreaFULL, SCROLL_DOWN);
+	fulldn.SelectFont(System5x7);
+	for(int i = 0; i < 12; i++)
+	{
+		fulldn.print("up ");
+		fulldn.println(i);
+	}
+	GLCD.DrawLine(0, 0, GLCD.Right, GLCD.Bottom);
+	GLCD.DrawBitmap(ArduinoIcon32x32, 40, 5);
+	GLCD.InvertRect(10, 10, 40, 30);
+	step("fulldown");
+
+#if glcd_PANEL_COUNT > 1
+	/*
+	 * panels updated alternately, a chart recorder column on each
+	 * and every so often a value
+	 */
+	for(uint8_t p = glcd_PANEL_COUNT; p--; )
+	{
+		GLCD.SelectPanel(p);
+		GLCD.ClearScreen();
+	}
+	step("panelclear");
+	for(int i = 0; i < 128; i++)
+	{
+		GLCD.SelectPanel(i % glcd_PANEL_COUNT);
+		GLCD.GotoXY(i / glcd_PANEL_COUNT, GLCD.Bottom - 7);
+		GLCD.WriteData(0xff << ((i * 5) & 7));
+		if(i % 32 < glcd_PANEL_COUNT)
+		{
+			GLCD.CursorTo(2, 2);
+			GLCD.print(i * 37);
+		}
+	}
+	GLCD.SelectPanel(0);
+	step("panels");
+#endif
+
+#ifdef SIM_ANIM
+	/*
+	 * erase/redraw animation, one Present() per frame
+	 */
+	GLCD.ClearScreen();
+	GLCD.DrawRect(0, 0, GLCD.Width-1, GLCD.Height-1);
+	GLCD.Present();
+	glcdsim_ClearCounters();
+	for(int f = 0; f < 20; f++)
+	{
+		GLCD.FillRect(4 + f, 20, 20, 10, WHITE);
+		GLCD.FillRect(4 + f + 1, 20, 20, 10);
+		GLCD.DrawBitmap(ArduinoIcon32x32, 60, 16);	// static, redrawn every frame
+		GLCD.Present();
+	}
+	step("anim");
+#endif
+
+	GLCD.ClearScreen();
+	picture();
+	step("picture");
+
+	if(img)
+		fclose(img);
+#ifdef GLCD_BUS_TRACE
+	if(trace.fp)
+		fclose(trace.fp);
+#endif
+	return(0);
+}
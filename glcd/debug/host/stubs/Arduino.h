@@ -0,0 +1,42 @@
+/*
+ * Arduino.h - host stub used to build the glcd library on a workstation
+ */
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <avr/pgmspace.h>
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#define HIGH 1
+#define LOW  0
+#define INPUT  0
+#define OUTPUT 1
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+#define BYTE 0
+
+#ifndef _BV
+#define _BV(bit) (1 << (bit))
+#endif
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+unsigned long millis(void);
+unsigned long micros(void);
+
+#include "WString.h"
+#include "Print.h"
+
+#endif
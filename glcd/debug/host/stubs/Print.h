@@ -0,0 +1,46 @@
+/*
+ * Print.h - host stub of the Arduino Print class
+ */
+#ifndef Print_h
+#define Print_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "WString.h"
+
+class Print
+{
+  public:
+	virtual size_t write(uint8_t) = 0;
+	virtual ~Print() {}
+
+	size_t write(const char *str) { size_t n = 0; while(*str) n += write((uint8_t)*str++); return n; }
+	size_t print(const char *s) { return write(s); }
+	size_t print(const String &s) { return write(s.c_str()); }
+	size_t print(char c) { return write((uint8_t)c); }
+	size_t print(long n, int base = 10) { return printNumber(n, base); }
+	size_t print(int n, int base = 10) { return printNumber(n, base); }
+	size_t print(unsigned int n, int base = 10) { return printNumber(n, base); }
+	size_t print(unsigned long n, int base = 10) { return printNumber(n, base); }
+	size_t print(unsigned char n, int base = 10) { return printNumber(n, base); }
+	size_t print(double n, int digits = 2) { char b[32]; snprintf(b, sizeof(b), "%.*f", digits, n); return write(b); }
+	size_t println(void) { return write((uint8_t)'\n'); }
+	template<class T> size_t println(T v) { size_t n = print(v); return n + println(); }
+	template<class T> size_t println(T v, int b) { size_t n = print(v, b); return n + println(); }
+
+  private:
+	size_t printNumber(long n, int base)
+	{
+	char b[40];
+		if(base == 16)
+			snprintf(b, sizeof(b), "%lX", n);
+		else if(base == 8)
+			snprintf(b, sizeof(b), "%lo", n);
+		else
+			snprintf(b, sizeof(b), "%ld", n);
+		return write(b);
+	}
+};
+
+#endif
@@ -0,0 +1,20 @@
+/*
+ * WString.h - host stub of the Arduino String class (just enough for gText)
+ */
+#ifndef String_class_h
+#define String_class_h
+
+#include <string.h>
+
+class String
+{
+  public:
+	String(const char *s = "") { strncpy(buf, s, sizeof(buf)-1); buf[sizeof(buf)-1] = 0; }
+	unsigned int length(void) const { return strlen(buf); }
+	char operator [](unsigned int i) const { return buf[i]; }
+	const char *c_str(void) const { return buf; }
+  private:
+	char buf[128];
+};
+
+#endif
@@ -0,0 +1,21 @@
+/*
+ * avr/pgmspace.h - host stub, program memory is ordinary memory
+ */
+#ifndef __PGMSPACE_H_
+#define __PGMSPACE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+typedef char prog_char;
+typedef uint8_t prog_uchar;
+typedef uint8_t prog_uint8_t;
+
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define memcpy_P(dst, src, n) memcpy(dst, src, n)
+
+#endif
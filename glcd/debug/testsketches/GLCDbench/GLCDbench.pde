@@ -0,0 +1,91 @@
+/*
+ * GLCDbench
+ *
+ * Runs each of the glcd benchmarks in glcdbench.h for about a second
+ * and sends the results to the serial port (9600 baud), one line per benchmark:
+ *
+ *	name ops/s us cmds writes reads busy
+ *
+ * The bus operation counts need GLCD_STATS turned on in glcd_Config.h,
+ * without it they are sent as -.
+ *
+ * Capture the output to a file and compare it with an earlier capture
+ * (the baseline) using the bench tool in debug/host:
+ *	bench -t 5 -c baseline.txt results.txt
+ * Anything that got more than 5% slower is reported.
+ * The host build runs the same benchmarks on a simulated panel (make bench).
+ */
+
+#include <glcd.h>
+#include "glcdbench.h"
+
+#define BENCH_MILLIS	1000	// how long each benchmark runs
+
+void setup()
+{
+  Serial.begin(9600);
+  GLCD.Init();
+
+  Serial.print("# glcdbench ");
+#ifdef glcd_ConfigName
+  Serial.print(glcd_ConfigName);
+#else
+  Serial.print(glcd_PanelConfigName);
+#endif
+  Serial.print(' ');
+  Serial.print(DISPLAY_WIDTH);
+  Serial.print('x');
+  Serial.println(DISPLAY_HEIGHT);
+  Serial.println("# name ops/s us cmds writes reads busy");
+}
+
+void loop()
+{
+glcdbench_t bench;
+unsigned long ops, startmillis, elapsed;
+
+  for(uint8_t n = 0; n < GLCDBENCH_COUNT; n++)
+  {
+    glcdbench_get(n, &bench);
+    GLCD.ClearScreen();
+    GLCD.Flush();
+    if(bench.setup)
+      bench.setup(bench.arg);
+    GLCD.Flush();
+#ifdef GLCD_STATS
+    GLCD.ResetStats();
+#endif
+
+    ops = 0;
+    startmillis = millis();
+    do
+    {
+      bench.op(bench.arg, ops);
+      GLCD.Flush();
+      ops++;
+      elapsed = millis() - startmillis;
+    } while(elapsed < BENCH_MILLIS);
+
+    Serial.print(bench.name);
+    Serial.print(' ');
+    Serial.print(ops * 1000 / elapsed);
+    Serial.print(' ');
+    Serial.print(elapsed * 1000.0 / ops, 1);
+#ifdef GLCD_STATS
+    glcdStats_t stats = GLCD.GetStats();
+    Serial.print(' ');
+    Serial.print((float) stats.cmds / ops, 1);
+    Serial.print(' ');
+    Serial.print((float) stats.writes / ops, 1);
+    Serial.print(' ');
+    Serial.print((float) stats.reads / ops, 1);
+    Serial.print(' ');
+    Serial.println((float) stats.busypolls / ops, 1);
+#else
+    Serial.println(" - - - -");
+#endif
+  }
+  Serial.println("# done");
+  while(1)
+    ;
+}
@@ -0,0 +1,365 @@
+/*
+ * glcdbench.h - the glcd benchmarks
+ *
+ * vi:ts=4
+ *
+ * This file is part of the Arduino GLCD library.
+ *
+ * The same benchmarks are run on the Arduino by GLCDbench.pde (ops/sec)
+ * and on the host by debug/host/bench.cpp (bus operations and simulated bus time),
+ * both print one line per benchmark in the same format:
+ *
+ *	name ops/s us cmds writes reads busy
+ *
+ *	ops/s	operations per second
+ *	us		microseconds per operation
+ *	cmds	commands per operation
+ *	writes	data writes per operation
+ *	reads	data reads per operation (dummy reads included)
+ *	busy	status polls that found the chip busy per operation
+ *
+ * Lines starting with # are comments, counts that are not known are printed as -
+ * (on the Arduino the counts need GLCD_STATS).
+ *
+ * Each benchmark starts on a cleared display, its setup function (if any) is
+ * called, then its operation is repeated, each time with the next i,
+ * and GLCD.Flush() after each one.
+ * Benchmark names must not have spaces and must be shorter than GLCDBENCH_NAMELEN.
+ */
+
+#ifndef GLCDBENCH_H
+#define GLCDBENCH_H
+
+#include <string.h>
+#include "fonts/SystemFont5x7.h"
+#include "fonts/Arial14.h"
+
+#define GLCDBENCH_NAMELEN	16
+
+typedef struct
+{
+	char name[GLCDBENCH_NAMELEN];
+	void (*setup)(uint8_t arg);
+	void (*op)(uint8_t arg, uint8_t i);
+	uint8_t arg;
+} glcdbench_t;
+
+/*
+ * a 16x16 image for the DrawBitmap() benchmarks
+ */
+static const uint8_t benchIcon16x16[] PROGMEM = {
+	16, 16,
+	0xff, 0x01, 0x05, 0x09, 0x11, 0x21, 0x41, 0x81, 0x81, 0x41, 0x21, 0x11, 0x09, 0x05, 0x01, 0xff,
+	0xff, 0x80, 0xa0, 0x90, 0x88, 0x84, 0x82, 0x81, 0x81, 0x82, 0x84, 0x88, 0x90, 0xa0, 0x80, 0xff
+};
+
+static gText benchText;
+static char benchString[] = "Hello 0123";
+static const char benchString_P[] PROGMEM = "Hello 0123";
+static uint8_t benchBuf[16];
+
+/*
+ * the largest distance from the center that fits the display both ways
+ */
+#define BENCH_REACH	((GLCD.CenterX < GLCD.CenterY ? GLCD.CenterX : GLCD.CenterY) - 1)
+
+/*
+ * setup functions, arg is the benchmark's arg
+ */
+
+static void benchSetupSystem(uint8_t arg)	// arg is the text area y
+{
+	benchText.DefineArea(0, arg, GLCD.Right, GLCD.Bottom, SCROLL_UP);
+	benchText.SelectFont(System5x7);
+}
+
+static void benchSetupArial(uint8_t arg)
+{
+	benchText.DefineArea(0, arg, GLCD.Right, GLCD.Bottom, SCROLL_UP);
+	benchText.SelectFont(Arial_14);
+}
+
+/*
+ * the scroll benchmarks start with the text area full so every line scrolls it
+ */
+static void benchFillArea(void)
+{
+	for(uint8_t row = 0; row < GLCD.Height/8; row++)
+		benchText.println(benchString);
+}
+
+static void benchSetupScroll(uint8_t arg)	// arg is the scroll direction, full display area
+{
+	benchText.DefineArea(0, 0, GLCD.Right, GLCD.Bottom, arg);
+	benchText.SelectFont(System5x7);
+	benchFillArea();
+}
+
+static void benchSetupScrollArea(uint8_t arg)	// arg is the scroll direction, left half, y not on a page boundary
+{
+	benchText.DefineArea(0, 3, GLCD.CenterX, GLCD.Bottom, arg);
+	benchText.SelectFont(System5x7);
+	benchFillArea();
+}
+
+static void benchSetupFill(uint8_t arg)
+{
+	GLCD.FillRect(0, 0, GLCD.CenterX, GLCD.Bottom);		// something to read
+}
+
+/*
+ * operations, arg is the benchmark's arg and i counts up from 0
+ */
+
+static void benchClearScreen(uint8_t arg, uint8_t i)
+{
+	GLCD.ClearScreen(i & 1 ? BLACK : WHITE);
+}
+
+static void benchSetDisplayMode(uint8_t arg, uint8_t i)
+{
+	GLCD.SetDisplayMode(i & 1 ? NON_INVERTED : INVERTED);
+}
+
+static void benchSetDot(uint8_t arg, uint8_t i)
+{
+	GLCD.SetDot(i * 7 % GLCD.Width, i * 5 % GLCD.Height, BLACK);
+}
+
+static void benchDrawHLine(uint8_t arg, uint8_t i)
+{
+	GLCD.DrawHLine(0, i * 3 % GLCD.Height, GLCD.Right);
+}
+
+static void benchDrawVLine(uint8_t arg, uint8_t i)
+{
+	GLCD.DrawVLine(i * 7 % GLCD.Width, 0, GLCD.Bottom);
+}
+
+/*
+ * a line from the center in octant arg (0 is right and a little down, counting clockwise)
+ */
+static void benchDrawLine(uint8_t arg, uint8_t i)
+{
+int8_t dx, dy, r = BENCH_REACH;
+
+	dx = r;
+	dy = r/2 - (i & 3);
+	if((arg + 1) & 2)
+	{
+		dx = dy;		// steep octants
+		dy = r;
+	}
+	if(arg == 2 || arg == 3 || arg == 4 || arg == 5)
+		dx = -dx;
+	if(arg >= 4)
+		dy = -dy;
+	GLCD.DrawLine(GLCD.CenterX, GLCD.CenterY, GLCD.CenterX + dx, GLCD.CenterY + dy);
+}
+
+static void benchDrawRect(uint8_t arg, uint8_t i)
+{
+	GLCD.DrawRect(i & 7, i & 7, GLCD.CenterX, GLCD.CenterY, i & 8 ? WHITE : BLACK);
+}
+
+static void benchDrawRoundRect(uint8_t arg, uint8_t i)
+{
+	GLCD.DrawRoundRect(i & 7, i & 7, GLCD.CenterX, GLCD.CenterY, 5, i & 8 ? WHITE : BLACK);
+}
+
+/*
+ * arg is the y phase of the rectangle, 8 for a different phase each time
+ */
+static void benchFillRect(uint8_t arg, uint8_t i)
+{
+uint8_t y = arg == 8 ? (i & 7) : arg;
+
+	GLCD.FillRect(i & 15, y, GLCD.CenterX, 15, i & 1 ? WHITE : BLACK);
+}
+
+static void benchInvertRect(uint8_t arg, uint8_t i)
+{
+uint8_t y = arg == 8 ? (i & 7) : arg;
+
+	GLCD.InvertRect(i & 15, y, GLCD.CenterX, 15);
+}
+
+static void benchDrawCircle(uint8_t arg, uint8_t i)
+{
+	GLCD.DrawCircle(GLCD.CenterX, GLCD.CenterY, BENCH_REACH - (i & 3), i & 4 ? WHITE : BLACK);
+}
+
+static void benchFillCircle(uint8_t arg, uint8_t i)
+{
+	GLCD.FillCircle(GLCD.CenterX, GLCD.CenterY, BENCH_REACH - (i & 3), i & 4 ? WHITE : BLACK);
+}
+
+/*
+ * arg is the y phase of the bitmap
+ */
+static void benchDrawBitmap(uint8_t arg, uint8_t i)
+{
+	GLCD.DrawBitmap(benchIcon16x16, i * 8 % (GLCD.Width - 16), arg);
+}
+
+static void benchWriteData(uint8_t arg, uint8_t i)
+{
+	GLCD.GotoXY(i * 7 % GLCD.Width, arg);
+	GLCD.WriteData(i);
+}
+
+static void benchReadData(uint8_t arg, uint8_t i)
+{
+	GLCD.GotoXY(i * 7 % GLCD.Width, arg);
+	GLCD.ReadData();
+}
+
+static void benchWriteDataBurst(uint8_t arg, uint8_t i)
+{
+	GLCD.GotoXY(i * 7 % (GLCD.Width - sizeof(benchBuf)), arg);
+	GLCD.WriteDataBurst(benchIcon16x16 + 2, sizeof(benchBuf), i & 1 ? WHITE : BLACK);
+}
+
+static void benchReadDataBurst(uint8_t arg, uint8_t i)
+{
+	GLCD.GotoXY(i * 7 % (GLCD.Width - sizeof(benchBuf)), arg);
+	GLCD.ReadDataBurst(benchBuf, sizeof(benchBuf));
+}
+
+static void benchPutChar(uint8_t arg, uint8_t i)
+{
+	benchText.CursorTo(i % 10, 0);
+	benchText.PutChar('A' + i % 26);
+}
+
+static void benchPuts(uint8_t arg, uint8_t i)
+{
+	benchText.CursorTo(0, i & 1);
+	benchText.Puts(benchString);
+}
+
+static void benchPuts_P(uint8_t arg, uint8_t i)
+{
+	benchText.CursorTo(0, i & 1);
+	benchText.Puts_P(benchString_P);
+}
+
+static void benchDrawString(uint8_t arg, uint8_t i)
+{
+	benchText.DrawString(benchString, i & 7, i & 7);
+}
+
+static void benchPrintNumber(uint8_t arg, uint8_t i)
+{
+	benchText.CursorTo(0, 0);
+	benchText.print(1000L * i - 12345L);
+}
+
+#ifndef GLCD_NO_PRINTF
+static void benchPrintf(uint8_t arg, uint8_t i)
+{
+	benchText.CursorTo(0, 0);
+	benchText.Printf("%s %d", "Count", i);
+}
+#endif
+
+static void benchEraseTextLine(uint8_t arg, uint8_t i)
+{
+	benchText.CursorTo(0, i & 1);
+	benchText.EraseTextLine(eraseFULL_LINE);
+}
+
+static void benchClearArea(uint8_t arg, uint8_t i)
+{
+	benchText.SetFontColor(i & 1 ? WHITE : BLACK);
+	benchText.ClearArea();
+}
+
+static void benchScroll(uint8_t arg, uint8_t i)
+{
+	benchText.println(benchString);
+}
+
+/*
+ * calls that don't touch the display
+ */
+static void benchStringWidth(uint8_t arg, uint8_t i)
+{
+	benchText.StringWidth(benchString);
+}
+
+static void benchSelectFont(uint8_t arg, uint8_t i)
+{
+	benchText.SelectFont(i & 1 ? Arial_14 : System5x7);
+}
+
+static const glcdbench_t glcdbench[] PROGMEM = {
+	{"ClearScreen",		0,						benchClearScreen,		0},
+	{"SetDisplayMode",	0,						benchSetDisplayMode,	0},
+	{"SetDot",			0,						benchSetDot,			0},
+	{"DrawHLine",		0,						benchDrawHLine,			0},
+	{"DrawVLine",		0,						benchDrawVLine,			0},
+	{"DrawLine_o0",		0,						benchDrawLine,			0},
+	{"DrawLine_o1",		0,						benchDrawLine,			1},
+	{"DrawLine_o2",		0,						benchDrawLine,			2},
+	{"DrawLine_o3",		0,						benchDrawLine,			3},
+	{"DrawLine_o4",		0,						benchDrawLine,			4},
+	{"DrawLine_o5",		0,						benchDrawLine,			5},
+	{"DrawLine_o6",		0,						benchDrawLine,			6},
+	{"DrawLine_o7",		0,						benchDrawLine,			7},
+	{"DrawRect",		0,						benchDrawRect,			0},
+	{"DrawRoundRect",	0,						benchDrawRoundRect,		0},
+	{"FillRect_y0",		0,						benchFillRect,			0},
+	{"FillRect_y3",		0,						benchFillRect,			3},
+	{"FillRect_yN",		0,						benchFillRect,			8},
+	{"InvertRect_y0",	0,						benchInvertRect,		0},
+	{"InvertRect_y3",	0,						benchInvertRect,		3},
+	{"InvertRect_yN",	0,						benchInvertRect,		8},
+	{"DrawCircle",		0,						benchDrawCircle,		0},
+	{"FillCircle",		0,						benchFillCircle,		0},
+	{"DrawBitmap_y0",	0,						benchDrawBitmap,		0},
+	{"DrawBitmap_y1",	0,						benchDrawBitmap,		1},
+	{"DrawBitmap_y2",	0,						benchDrawBitmap,		2},
+	{"DrawBitmap_y3",	0,						benchDrawBitmap,		3},
+	{"DrawBitmap_y4",	0,						benchDrawBitmap,		4},
+	{"DrawBitmap_y5",	0,						benchDrawBitmap,		5},
+	{"DrawBitmap_y6",	0,						benchDrawBitmap,		6},
+	{"DrawBitmap_y7",	0,						benchDrawBitmap,		7},
+	{"WriteData_y0",	0,						benchWriteData,			0},
+	{"WriteData_y3",	0,						benchWriteData,			3},
+	{"ReadData",		benchSetupFill,			benchReadData,			0},
+	{"WriteDataBurst",	0,						benchWriteDataBurst,	8},
+	{"ReadDataBurst",	benchSetupFill,			benchReadDataBurst,		8},
+	{"PutChar",			benchSetupSystem,		benchPutChar,			0},
+	{"PutChar_y3",		benchSetupSystem,		benchPutChar,			3},
+	{"Puts",			benchSetupSystem,		benchPuts,				0},
+	{"Puts_y3",			benchSetupSystem,		benchPuts,				3},
+	{"Puts_P",			benchSetupSystem,		benchPuts_P,			0},
+	{"Puts_prop",		benchSetupArial,		benchPuts,				0},
+	{"Puts_prop_y3",	benchSetupArial,		benchPuts,				3},
+	{"DrawString",		benchSetupSystem,		benchDrawString,		0},
+	{"PrintNumber",		benchSetupSystem,		benchPrintNumber,		0},
+#ifndef GLCD_NO_PRINTF
+	{"Printf",			benchSetupSystem,		benchPrintf,			0},
+#endif
+	{"EraseTextLine",	benchSetupSystem,		benchEraseTextLine,		0},
+	{"ClearArea",		benchSetupSystem,		benchClearArea,			3},
+	{"ScrollUp",		benchSetupScroll,		benchScroll,			SCROLL_UP},
+	{"ScrollDown",		benchSetupScroll,		benchScroll,			SCROLL_DOWN},
+	{"ScrollUp_area",	benchSetupScrollArea,	benchScroll,			SCROLL_UP},
+	{"ScrollDown_area",	benchSetupScrollArea,	benchScroll,			SCROLL_DOWN},
+	{"StringWidth",		benchSetupSystem,		benchStringWidth,		0},
+	{"SelectFont",		0,						benchSelectFont,		0},
+};
+
+#define GLCDBENCH_COUNT	(sizeof(glcdbench) / sizeof(glcdbench[0]))
+
+/*
+ * copy benchmark n out of program memory
+ */
+static void glcdbench_get(uint8_t n, glcdbench_t *bench)
+{
+	memcpy_P(bench, &glcdbench[n], sizeof(glcdbench_t));
+}
+
+#endif
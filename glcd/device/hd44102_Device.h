@@ -55,6 +55,14 @@
 #define LCD_BUSY_FLAG		0x80 
 #define LCD_BUSY_BIT		7
 
+// busy times (ns): no datasheet figure, the ks0108 margin of 3 E cycles at the 1000ns minimum cycle
+#ifndef GLCD_tBUSY_CMD
+#define GLCD_tBUSY_CMD		3000	// command execution time
+#endif
+#ifndef GLCD_tBUSY_DATA
+#define GLCD_tBUSY_DATA		3000	// data read/write execution time
+#endif
+
 /*
  * Define primitives used by glcd_Device.cpp --------------------------------
  */
@@ -21,35 +21,68 @@
  *
  */
 
-#if glcd_CHIP_COUNT == 2 && !defined(glcd_CHIP1)
+/*
+ * chip select strings are needed for the chips of every panel (see glcd_Device.h)
+ */
+#ifndef glcd_PANEL_COUNT
+#define glcd_PANEL_COUNT 1
+#endif
+#define glcd_DevCHIPS	(glcd_CHIP_COUNT * glcd_PANEL_COUNT)
+
+#if glcd_DevCHIPS >= 2 && !defined(glcd_CHIP1)
 #error "2 chips defined but glcd_CHIP1 chip selects not defined"
 #endif
 
-#if glcd_CHIP_COUNT == 3 && !defined(glcd_CHIP2)
+#if glcd_DevCHIPS >= 3 && !defined(glcd_CHIP2)
 #error "3 chips defined but glcd_CHIP2 chip selects not defined"
 #endif
 
-#if glcd_CHIP_COUNT == 4 && !defined(glcd_CHIP3)
+#if glcd_DevCHIPS >= 4 && !defined(glcd_CHIP3)
 #error "4 chips defined but glcd_CHIP3 chip selects not defined"
 #endif
 
-#if defined(glcd_CHIP3) && glcd_CHIP_COUNT < 4
-#error "glcd_CHIP3 defined for less than 4 chips"
+#if glcd_DevCHIPS >= 5 && !defined(glcd_CHIP4)
+#error "5 chips defined but glcd_CHIP4 chip selects not defined"
 #endif
 
-#if defined(glcd_CHIP2) && glcd_CHIP_COUNT < 3
-#error "glcd_CHIP2 defined for less than 3 chips"
+#if glcd_DevCHIPS >= 6 && !defined(glcd_CHIP5)
+#error "6 chips defined but glcd_CHIP5 chip selects not defined"
 #endif
 
-#if defined(glcd_CHIP1) && glcd_CHIP_COUNT < 2
-#error "glcd_CHIP1 defined for less than 2 chips"
+#if glcd_DevCHIPS >= 7 && !defined(glcd_CHIP6)
+#error "7 chips defined but glcd_CHIP6 chip selects not defined"
+#endif
+
+#if glcd_DevCHIPS >= 8 && !defined(glcd_CHIP7)
+#error "8 chips defined but glcd_CHIP7 chip selects not defined"
 #endif
 
+#if defined(glcd_CHIP7) && glcd_DevCHIPS < 8
+#error "glcd_CHIP7 defined for less than 8 chips"
+#endif
 
-#if DISPLAY_WIDTH > 255
-#warning "Current ks0108 code only suports up to 255 pixels, downsizing width to 255"
-#undef DISPLAY_WIDTH
-#define DISPLAY_WIDTH 255
+#if defined(glcd_CHIP6) && glcd_DevCHIPS < 7
+#error "glcd_CHIP6 defined for less than 7 chips"
+#endif
+
+#if defined(glcd_CHIP5) && glcd_DevCHIPS < 6
+#error "glcd_CHIP5 defined for less than 6 chips"
+#endif
+
+#if defined(glcd_CHIP4) && glcd_DevCHIPS < 5
+#error "glcd_CHIP4 defined for less than 5 chips"
+#endif
+
+#if defined(glcd_CHIP3) && glcd_DevCHIPS < 4
+#error "glcd_CHIP3 defined for less than 4 chips"
+#endif
+
+#if defined(glcd_CHIP2) && glcd_DevCHIPS < 3
+#error "glcd_CHIP2 defined for less than 3 chips"
+#endif
+
+#if defined(glcd_CHIP1) && glcd_DevCHIPS < 2
+#error "glcd_CHIP1 defined for less than 2 chips"
 #endif
 
 
@@ -84,6 +117,14 @@
 #define LCD_RESET_BIT		4
 #define LCD_RESET_FLAG		0x10
 
+// busy times (ns): no datasheet figure, 3 E cycles at the 1000ns minimum cycle (tWH + tWL + setup)
+#ifndef GLCD_tBUSY_CMD
+#define GLCD_tBUSY_CMD		3000	// command execution time
+#endif
+#ifndef GLCD_tBUSY_DATA
+#define GLCD_tBUSY_DATA		3000	// data read/write execution time
+#endif
+
 /*
  * Define primitives used by glcd_Device.cpp --------------------------------
  */
@@ -114,11 +155,27 @@
  * on the ks0108 are powers of 2
  */
 #if CHIP_HEIGHT < DISPLAY_HEIGHT
-#define glcd_DevXYval2Chip(x,y) ((x/CHIP_WIDTH) + ((y/CHIP_HEIGHT) * (DISPLAY_HEIGHT/CHIP_HEIGHT)))
+#define glcd_DevXYval2Chip(x,y) ((x/CHIP_WIDTH) + ((y/CHIP_HEIGHT) * (DISPLAY_HEIGHT/CHIP_HEIGHT)))
 #else
 #define glcd_DevXYval2Chip(x,y)		((x/CHIP_WIDTH))	
 #endif
 
 #define glcd_DevXval2ChipCol(x)		((x) % CHIP_WIDTH)
 
+/*
+ * The column (Y) address counter wraps from 63 back to 0
+ */
+#define glcd_DevColWrap				64
+
+/*
+ * The display start line wraps from 63 back to 0
+ */
+#define glcd_DevRowWrap				64
+
+/*
+ * The chips share glcdEN and every chip starts at column 0,
+ * so a panel config can select them all at once (glcd_CHIPALL)
+ */
+#define glcd_DevChipAll
+
 #endif //GLCD_PANEL_DEVICE_H
@@ -63,6 +63,8 @@
 #define LCD_NORMALLCD		0xa6	// black dots on white backbround
 
 #define LCD_RESET			0xE2	// Reset command not signal reset
+#define LCD_RMW				0xE0	// start RMW mode
+#define LCD_RMW_END			0xEE	// end RMW mode
 
 /*
  * Status register bits/flags -----------------------------------------------
@@ -71,6 +73,14 @@
 #define LCD_BUSY_FLAG		0x80 
 #define LCD_BUSY_BIT		7
 
+// busy times (ns): no datasheet figure, one 1000ns E cycle for commands and half that for data
+#ifndef GLCD_tBUSY_CMD
+#define GLCD_tBUSY_CMD		1000	// command execution time
+#endif
+#ifndef GLCD_tBUSY_DATA
+#define GLCD_tBUSY_DATA		500	// data read/write execution time
+#endif
+
 /*
  * Define primitives used by glcd_Device.cpp --------------------------------
  */
@@ -97,12 +107,17 @@
 
 #define glcd_DevXval2ChipCol(x)	(x)	// no multi chip support yet
 
+/*
+ * The display start line wraps from 63 back to 0
+ */
+#define glcd_DevRowWrap			64
+
 /*
  * Convert from chip column value to hi/lo address value
  * for LCD commands.
  */
 
-#define glcd_DevCol2addrlo(x)		(x & 0xf)	// lo nibble
-#define glcd_DevCol2addrhi(x)		(x & 0xf0)	// hi nibble
+#define glcd_DevCol2addrlo(x)		((x) & 0xf)	// lo nibble
+#define glcd_DevCol2addrhi(x)		((x) >> 4)	// hi nibble
 
 #endif //GLCD_PANEL_DEVICE_H
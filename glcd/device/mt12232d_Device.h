@@ -79,6 +79,14 @@
 #define LCD_RESET_BIT		4
 #define LCD_RESET_FLAG		0x10
 
+// busy times (ns): the sed1520 values, the module uses sed1520 compatible chips
+#ifndef GLCD_tBUSY_CMD
+#define GLCD_tBUSY_CMD		1000	// command execution time
+#endif
+#ifndef GLCD_tBUSY_DATA
+#define GLCD_tBUSY_DATA		1000	// data read/write execution time
+#endif
+
 /*
  * Define primitives used by glcd_Device.cpp --------------------------------
  */
@@ -127,6 +135,11 @@
 
 #define glcd_DevXval2ChipCol(x)		((x) < CHIP_WIDTH ? (x + 0x13) : (x - CHIP_WIDTH))
 
+/*
+ * The display start line wraps from 31 back to 0
+ */
+#define glcd_DevRowWrap				32
+
 /*
  * Custom init routine
  * This module is VERY funky!
@@ -63,6 +63,8 @@
 #define LCD_STATICDRIVE_ON	0xA5	// static drive all segments lit (power save)
 #define LCD_DUTY_16			0xA8	// 1/16 duty factor for driving LCD cells
 #define LCD_DUTY_32			0xA9	// 1/32 duty factor for driving LCD cells
+#define LCD_RMW				0xE0	// start RMW mode
+#define LCD_RMW_END			0xEE	// end RMW mode
 
 /*
  * Status register bits/flags -----------------------------------------------
@@ -76,6 +78,14 @@
 #define LCD_RESET_BIT		4
 #define LCD_RESET_FLAG		0x10
 
+// busy times (ns): no datasheet figure, one half E cycle (Tcyc/2, see GLCD_tWH in Modmt12232d_Manual_Config.h)
+#ifndef GLCD_tBUSY_CMD
+#define GLCD_tBUSY_CMD		1000	// command execution time
+#endif
+#ifndef GLCD_tBUSY_DATA
+#define GLCD_tBUSY_DATA		1000	// data read/write execution time
+#endif
+
 /*
  * Define primitives used by glcd_Device.cpp --------------------------------
  */
@@ -110,7 +120,7 @@ do									\
 {									\
 	if(chip == 0)					\
 	   lcdfastWrite(glcdE1, LOW);	\
-	else							\ 
+	else							\
 	   lcdfastWrite(glcdE2, LOW);	\
 }while(0)
 
@@ -126,4 +136,9 @@ do									\
 
 #define glcd_DevXval2ChipCol(x)		((x) < CHIP_WIDTH ? x : (x - CHIP_WIDTH))
 
+/*
+ * The display start line wraps from 31 back to 0
+ */
+#define glcd_DevRowWrap				32
+
 #endif //GLCD_PANEL_DEVICE_H
@@ -16,8 +16,19 @@ The following lcd primitives must be defined
 
 	For devices that split set column into to 2 commands of hi/lo: 
 
-	glcd_DevCol2addrlo(x)		(x & 0xf)	// lo nibble
-	glcd_DevCol2addrhi(x)		(x & 0xf0)	// hi nibble
+	glcd_DevCol2addrlo(x)		((x) & 0xf)	// lo nibble
+	glcd_DevCol2addrhi(x)		((x) >> 4)	// hi nibble
+
+	Optional, for devices whose column address wraps back to 0 after
+	the last column (used by GLCD_XCOL_SUPPORT column tracking):
+
+	glcd_DevColWrap			number of columns in the chip
+
+	Optional, for devices whose display start line (LCD_DISP_START | line)
+	wraps back to 0 after the last row (used to scroll the whole display
+	by moving the start line):
+
+	glcd_DevRowWrap			number of rows in the chip
   
 */
 
@@ -80,6 +91,17 @@ The following lcd primitives must be defined
 #define LCD_BUSY_FLAG
 #define LCD_BUSY_BIT
 
+/*
+ * Worst case instruction execution (busy) times in nanoseconds
+ * used in place of status polling by the timed busy modes (GLCD_BUSYMODE).
+ */
+#ifndef GLCD_tBUSY_CMD
+#define GLCD_tBUSY_CMD
+#endif
+#ifndef GLCD_tBUSY_DATA
+#define GLCD_tBUSY_DATA
+#endif
+
 
 
 /*
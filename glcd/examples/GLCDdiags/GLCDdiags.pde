@@ -58,6 +58,20 @@
 #define SerialPrintPINstr(x) _SerialPrintPINStr(x)
 #endif
 
+/*
+ * control lines can be on the shift register of the shift register bus
+ * and are always on port B of the I2C port expander bus
+ */
+#if defined(GLCD_SPI_BUS)
+#define SerialPrintCTLstr(x) \
+  do { if((x) >= SR_Q0) { SerialPrintQ("SR_Q"); Serial.print((int)((x) - SR_Q0)); } else { SerialPrintPINstr(x); } } while(0)
+#elif defined(GLCD_I2C_BUS)
+#define SerialPrintCTLstr(x) \
+  do { SerialPrintQ("GPB"); Serial.print((int)((x) & 7)); } while(0)
+#else
+#define SerialPrintCTLstr(x) SerialPrintPINstr(x)
+#endif
+
 /*
  * declare a string for a horizontal line in program memory
  */
@@ -174,8 +188,10 @@ void showchipselscreen(void)
   for(int x = 0; x < GLCD.Width; x++)
   {
      GLCD.DrawVLine( x, 0, map(x, 0, GLCD.Right, 0, GLCD.Bottom));
+     GLCD.Flush(); // push any write back cache data to the display
      delay(50); // delay is to allow seeing if chip selects are duplicated or overlapping
   }   
+  GLCD.Flush();
   delay(4000);
   // show chips
   GLCD.ClearScreen();
@@ -191,10 +207,12 @@ void showchipselscreen(void)
         GLCD.SetFontColor(WHITE);
       GLCD.print("Chip:");
       GLCD.print(chip);
+      GLCD.Flush();
       delay(350); 
     }
   }
 
+  GLCD.Flush();
   delay(5000);
 
   /*
@@ -212,6 +230,7 @@ void showchipselscreen(void)
   {
      GLCD.print(char('A' + i)); // show the ascii character
   }
+  GLCD.Flush();
   delay(5000);
 }
 
@@ -270,7 +289,13 @@ int status;
 
     SerialPrintQ("Displaying ChipSelect Screens\n");
     showchipselscreen();
-    if( lcdmemtest())
+    status = lcdmemtest();
+    if(GLCD.GetError() == GLCD_EBUSY)
+    {
+      SerialPrintQ("BUSY wait Timeout during the tests\n");
+      status = 1;
+    }
+    if(status)
     {
       /*
        * memory tests failed.
@@ -316,10 +341,25 @@ int status;
       Serial.print(kops);
       SerialPrintQ(".");
       Serial.println(kops_fract);
+
+#ifdef GLCD_WRITE_COUNTS
+      /*
+       * report how many data bytes went to the glcd and
+       * how many were skipped because the glcd already had them.
+       */
+      SerialPrintQ("Data writes sent: ");
+      Serial.print(GLCD.WritesSent);
+      SerialPrintQ(" skipped: ");
+      Serial.println(GLCD.WritesSkipped);
+#endif
+#ifdef GLCD_STATS
+      showglcdstats();
+#endif
     }
 
 finished:
 
+    GLCD.Flush();
     delay(5000);
     lcount++;
   }
@@ -368,6 +408,7 @@ uint8_t lcdmemtest(void)
     GLCD.print((int)col);
     GLCD.print('-');
     GLCD.print((int)ecol);
+    GLCD.Flush();
     delay(500);
 
 //  SerialPrintf("Horizontal Page Test Chip: %d Pixels %d-%d\n", chip, col, ecol);
@@ -407,6 +448,7 @@ uint8_t lcdmemtest(void)
   GLCD.print((int)0);
   GLCD.print('-');
   GLCD.print((int)GLCD.Right);
+  GLCD.Flush();
   delay(1000);
 
 //SerialPrintf("Full Module Horizontal Page Test:Pixels %d-%d\n",  0, GLCD.Right);
@@ -786,19 +828,19 @@ void showGLCDconfig(void)
 
 #ifdef glcdCSEL1
   SerialPrintQ(" CSEL1:");
-  SerialPrintPINstr(glcdCSEL1);
+  SerialPrintCTLstr(glcdCSEL1);
 #endif
 #ifdef glcdCSEL2
   SerialPrintQ(" CSEL2:");
-  SerialPrintPINstr(glcdCSEL2);
+  SerialPrintCTLstr(glcdCSEL2);
 #endif
 #ifdef glcdCSEL3
   SerialPrintQ(" CSEL3:");
-  SerialPrintPINstr(glcdCSEL3);
+  SerialPrintCTLstr(glcdCSEL3);
 #endif
 #ifdef glcdCSEL4
   SerialPrintQ(" CSEL4:");
-  SerialPrintPINstr(glcdCSEL4);
+  SerialPrintCTLstr(glcdCSEL4);
 #endif
 
 #if defined(glcdCSEL1) || defined(glcdCSEL2) || defined(glcdCSEL3) || defined(glcdCSEL4)
@@ -808,30 +850,39 @@ void showGLCDconfig(void)
 
 #ifdef glcdRES
   SerialPrintQ(" RES:");
-  SerialPrintPINstr(glcdRES);
+  SerialPrintCTLstr(glcdRES);
 #endif
   SerialPrintQ(" RW:");
-  SerialPrintPINstr(glcdRW);
+  SerialPrintCTLstr(glcdRW);
 
   SerialPrintQ(" DI:");
-  SerialPrintPINstr(glcdDI);
+  SerialPrintCTLstr(glcdDI);
 
 #ifdef glcdEN
   SerialPrintQ(" EN:");
-  SerialPrintPINstr(glcdEN);
+  SerialPrintCTLstr(glcdEN);
 #endif
 
 #ifdef glcdE1
   SerialPrintQ(" E1:");
-  SerialPrintPINstr(glcdE1);
+  SerialPrintCTLstr(glcdE1);
 #endif
 #ifdef glcdE2
   SerialPrintQ(" E2:");
-  SerialPrintPINstr(glcdE2);
+  SerialPrintCTLstr(glcdE2);
 #endif
 
   Serial.println();
 
+#if defined(GLCD_SPI_BUS)
+  SerialPrintQ(" LATCH:");
+  SerialPrintPINstr(glcdSPI_LATCH);
+  SerialPrintQ(" D0-D7:shift register\n");
+#elif defined(GLCD_I2C_BUS)
+  SerialPrintQ(" I2C address:0x");
+  Serial.print(glcdI2C_ADDR, HEX);
+  SerialPrintQ(" D0-D7:GPA0-GPA7\n");
+#else
 //  SerialPrintf(" D0:%s", GLCDdiagsPIN2STR(glcdData0Pin));
   SerialPrintQ(" D0:");
   SerialPrintPINstr(glcdData0Pin);
@@ -860,6 +911,7 @@ void showGLCDconfig(void)
   SerialPrintPINstr(glcdData7Pin);
 
   Serial.println();
+#endif
 
 //  SerialPrintf("Delays: tDDR:%d tAS:%d tDSW:%d tWH:%d tWL: %d\n",
 //  GLCD_tDDR, GLCD_tAS, GLCD_tDSW, GLCD_tWH, GLCD_tWL);
@@ -904,7 +956,11 @@ void showGLCDconfig(void)
 
 
 
-#ifdef _AVRIO_AVRIO_
+#if defined(GLCD_SPI_BUS)
+  SerialPrintQ("Data mode: SPI shift register\n");
+#elif defined(GLCD_I2C_BUS)
+  SerialPrintQ("Data mode: I2C port expander\n");
+#elif defined(_AVRIO_AVRIO_)
   /*
    * Show AVRIO GLCD data mode
    *
@@ -988,6 +1044,68 @@ void showGLCDconfig(void)
   SerialPrintQ("READ CACHE enabled\n");
 #endif
 
+  /*
+   * show busy mode if not status polling
+   */
+#if GLCD_BUSYMODE == GLCD_BUSY_TIMED
+  SerialPrintQ("TIMED busy mode\n");
+#elif GLCD_BUSYMODE == GLCD_BUSY_HYBRID
+  SerialPrintQ("HYBRID busy mode\n");
+#elif GLCD_BUSYMODE == GLCD_BUSY_ADAPTIVE
+  SerialPrintQ("ADAPTIVE busy mode\n");
+#endif
+
+  /*
+   * show WRITEBACK CACHE if enabled
+   */
+#ifdef GLCD_WRITEBACK_CACHE
+  SerialPrintQ("WRITEBACK CACHE enabled\n");
+#endif
+
+  /*
+   * show if a front buffer is used
+   */
+#ifdef GLCD_DOUBLE_BUFFER
+  SerialPrintQ("DOUBLE BUFFER enabled\n");
+#endif
+
+  /*
+   * show if the frame buffer is flushed by a timer interrupt
+   */
+#ifdef GLCD_ASYNC_FLUSH
+  SerialPrintQ("ASYNC FLUSH enabled\n");
+#endif
+
+  /*
+   * show if identical pages are written to all chips at once
+   */
+#ifdef GLCD_CHIP_BROADCAST
+  SerialPrintQ("CHIP BROADCAST enabled\n");
+#endif
+
+  /*
+   * show if full display text areas scroll using the display start line
+   */
+#ifdef GLCD_HW_SCROLL
+  SerialPrintQ("HW SCROLL enabled\n");
+#endif
+
+  /*
+   * show if bus transactions are recorded
+   */
+#ifdef GLCD_BUS_TRACE
+  SerialPrintQ("BUS TRACE enabled (");
+  Serial.print(GLCD_TRACE_SIZE);
+  SerialPrintQ(" bytes)\n");
+#endif
+
+  /*
+   * show if bus operations are counted
+   */
+#ifdef GLCD_STATS
+  SerialPrintQ("STATS enabled\n");
+#endif
+
 
 }
 
@@ -1039,6 +1157,125 @@ _SerialPrintPINstr(uint16_t pin)
 #endif
 
 
+#ifdef GLCD_STATS
+/*
+ * Draw with each of the drawing primitives and report the glcd bus operations
+ * each one took, to see where the bus time goes on this panel.
+ * The columns are the glcdStats_t counters:
+ * all commands, set page and set column commands, data reads, dummy data reads,
+ * data writes, data writes of bytes merged for a y not on a page boundary,
+ * chip switches and status polls that found the chip busy.
+ */
+void showglcdstats(void)
+{
+uint8_t i;
+
+  SerialPrintQ("GLCD bus operations per primitive:\n");
+  SerialPrintQ("primitive\tcmds\tpage\tcol\treads\tdummy\twrites\tunalign\tchipsw\tbusy\n");
+
+  GLCD.ResetStats();
+  GLCD.ClearScreen();
+  printglcdstats(PSTR("ClearScreen"));
+
+  GLCD.ResetStats();
+  GLCD.FillRect(0, 0, GLCD.CenterX, 16);
+  printglcdstats(PSTR("FillRect"));
+
+  GLCD.ResetStats();
+  GLCD.FillRect(GLCD.CenterX, 3, GLCD.CenterX-1, 10);
+  printglcdstats(PSTR("FillRect y3"));
+
+  GLCD.ResetStats();
+  GLCD.InvertRect(0, 0, GLCD.CenterX, GLCD.CenterY);
+  printglcdstats(PSTR("InvertRect"));
+
+  GLCD.ResetStats();
+  GLCD.DrawLine(0, 0, GLCD.Right, GLCD.Bottom);
+  printglcdstats(PSTR("DrawLine"));
+
+  GLCD.ResetStats();
+  GLCD.DrawCircle(GLCD.CenterX, GLCD.CenterY, GLCD.CenterY-1);
+  printglcdstats(PSTR("DrawCircle"));
+
+  GLCD.ResetStats();
+  for(i = 0; i < 16; i++)
+    GLCD.SetDot(i * 7 % DISPLAY_WIDTH, i * 3 % DISPLAY_HEIGHT, BLACK);
+  printglcdstats(PSTR("SetDot x16"));
+
+  GLCD.ResetStats();
+  GLCD.CursorTo(0, 0);
+  GLCD.print("0123456789");
+  printglcdstats(PSTR("print"));
+
+  GLCD.ResetStats();
+  GLCD.CursorToXY(1, 3);
+  GLCD.print("0123456789");
+  printglcdstats(PSTR("print y3"));
+
+  /*
+   * how long the chips stay busy, over a clear and a full screen of lines
+   */
+  GLCD.ResetStats();
+  GLCD.ClearScreen();
+  for(i = 0; i < GLCD.Width; i += 4)
+    GLCD.DrawLine(i, 0, GLCD.Right - i, GLCD.Bottom);
+  glcdStats_t stats = GLCD.GetStats();
+
+  SerialPrintQ("Busy waits by status polls that found the chip busy:\n");
+  SerialPrintQ("chip\t0\t1\t2-3\t4-7\t8-15\t16-31\t32-63\t64+\ttimeouts\n");
+  for(uint8_t chip = 0; chip < glcd_CHIP_COUNT; chip++)
+  {
+    Serial.print((int)chip);
+    for(i = 0; i < GLCD_BUSY_BINS; i++)
+    {
+      Serial.print('\t');
+      Serial.print(stats.busyhist[chip][i]);
+    }
+    Serial.println();
+  }
+  SerialPrintQ("timeouts: ");
+  Serial.println(stats.busytimeouts);
+#if defined(GLCD_PAGE_CACHE) || defined(GLCD_RLE_CACHE)
+  SerialPrintQ("cache hits/misses/evictions: ");
+  Serial.print(stats.cachehits);
+  Serial.print('/');
+  Serial.print(stats.cachemisses);
+  Serial.print('/');
+  Serial.println(stats.cacheevictions);
+#endif
+}
+
+/*
+ * report the counters for one primitive
+ */
+void printglcdstats(const prog_char *name)
+{
+glcdStats_t stats;
+
+  GLCD.Flush();	// the write back cache sends the drawing here
+  stats = GLCD.GetStats();
+  SerialPrintP(name);
+  Serial.print('\t');
+  Serial.print(stats.cmds);
+  Serial.print('\t');
+  Serial.print(stats.pagecmds);
+  Serial.print('\t');
+  Serial.print(stats.colcmds);
+  Serial.print('\t');
+  Serial.print(stats.reads);
+  Serial.print('\t');
+  Serial.print(stats.dummyreads);
+  Serial.print('\t');
+  Serial.print(stats.writes);
+  Serial.print('\t');
+  Serial.print(stats.unaligned);
+  Serial.print('\t');
+  Serial.print(stats.chipswitches);
+  Serial.print('\t');
+  Serial.println(stats.busypolls);
+}
+#endif
+
 /*
  * This function returns a composite "speed" of the glcd
  * by returning the SetDot() speed in 1/10 operations/sec.
@@ -53,7 +53,7 @@ gText::gText()
 
 // This constructor creates a text area with the given coordinates
 // full display area is used if any coordinate is invalid
-gText::gText(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, textMode mode) 
+gText::gText(glcdCoord_t x1, glcdCoord_t y1, glcdCoord_t x2, glcdCoord_t y2, textMode mode) 
 {
    //device = (glcd_Device*)&GLCD; 
    if( ! this->DefineArea(x1,y1,x2,y2,mode))
@@ -68,7 +68,7 @@ gText::gText(predefinedArea selection, textMode mode)
 
 }
 
-gText::gText(uint8_t x1, uint8_t y1, uint8_t columns, uint8_t rows, Font_t font, textMode mode)
+gText::gText(glcdCoord_t x1, glcdCoord_t y1, uint8_t columns, uint8_t rows, Font_t font, textMode mode)
 {
    //device = (glcd_Device*)&GLCD; 
    if( ! this->DefineArea(x1,y1,columns,rows,font, mode))
@@ -134,9 +134,9 @@ void gText::ClearArea(void)
  */
 
 uint8_t
-gText::DefineArea(uint8_t x, uint8_t y, uint8_t columns, uint8_t rows, Font_t font, textMode mode)
+gText::DefineArea(glcdCoord_t x, glcdCoord_t y, uint8_t columns, uint8_t rows, Font_t font, textMode mode)
 {
-uint8_t x2,y2;
+glcdCoord_t x2,y2;
 
 	this->SelectFont(font);
 
@@ -177,7 +177,7 @@ uint8_t x2,y2;
  */
 
 uint8_t
-gText::DefineArea(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, textMode mode)
+gText::DefineArea(glcdCoord_t x1, glcdCoord_t y1, glcdCoord_t x2, glcdCoord_t y2, textMode mode)
 {
 uint8_t ret = false;
 	if(		(x1 >= x2)
@@ -246,7 +246,15 @@ uint8_t ret = false;
 uint8_t
 gText::DefineArea(predefinedArea selection, textMode mode)
 {
-uint8_t x1,y1,x2,y2;
+glcdCoord_t x1,y1,x2,y2;
+#ifdef GLCD_WIDE_COORDS
+uint32_t tok = selection;
+
+	x1 = tok >> (16 + TAREA_YBITS);
+	y1 = (tok >> 16) & ((1 << TAREA_YBITS) - 1);
+	x2 = (uint16_t) tok >> TAREA_YBITS;
+	y2 = tok & ((1 << TAREA_YBITS) - 1);
+#else
 TareaToken tok;
 
 	tok.token = selection;
@@ -255,10 +263,101 @@ TareaToken tok;
 	y1 =  tok.coord.y1;
 	x2 =  tok.coord.x2;
 	y2 =  tok.coord.y2;
+#endif
 
 	return this->DefineArea(x1,y1,x2,y2, mode);
 }
 
+/*
+ * Return the bits of an LCD page that are in the pixel rows top through bottom
+ */
+static uint8_t PageRowMask(uint8_t page, int16_t top, int16_t bottom)
+{
+int16_t prow = page * 8;
+
+	if(top < prow)
+		top = prow;
+	if(bottom > prow + 7)
+		bottom = prow + 7;
+	if(top > bottom)
+		return(0);
+	return((0xFF >> (7 - (bottom - top))) << (top - prow));
+}
+
+/*
+ * Rebuild one LCD page of a scroll region
+ *
+ *	The page bits in keep are left alone, the bits in fill are set to color
+ *	and all the other bits are moved from the pixel rows starting at srow.
+ *	(srow is the source pixel row for bit 0 of the page and may be negative)
+ *
+ *	Rather than working a column at a time, the page is done in chunks of
+ *	columns so the data can be moved with burst reads and writes.
+ */
+void gText::ScrollPage(glcdCoord_t x1, glcdCoord_t x2, uint8_t page, int16_t srow,
+	uint8_t keep, uint8_t fill, uint8_t color)
+{
+uint8_t dbuf[GLCD_BURST_BUFSIZE];
+uint8_t lbuf[GLCD_BURST_BUFSIZE];
+uint8_t hbuf[GLCD_BURST_BUFSIZE];
+uint8_t move = ~(keep | fill);
+int8_t spage = (srow + 8) / 8 - 1;	// source page of bit 0 (floor of srow/8)
+uint8_t sbits = (srow + 8) & 7;		// bit offset of srow within that page
+uint8_t n, i;
+
+	while(x1 <= x2)
+	{
+		if(x2 - x1 >= GLCD_BURST_BUFSIZE)
+			n = GLCD_BURST_BUFSIZE;
+		else
+			n = x2 - x1 + 1;
+
+		if(keep)
+		{
+			glcd_Device::GotoXY(x1, page * 8);
+			glcd_Device::ReadDataBurst(dbuf, n);
+		}
+
+		if(move)
+		{
+			/*
+			 * The moved bits come from up to two source pages.
+			 */
+			for(i = 0; i < n; i++)
+				lbuf[i] = hbuf[i] = 0;
+
+			if(spage >= 0)
+			{
+				glcd_Device::GotoXY(x1, spage * 8);
+				glcd_Device::ReadDataBurst(lbuf, n);
+			}
+			if(sbits && ((spage + 1) * 8 < DISPLAY_HEIGHT))
+			{
+				glcd_Device::GotoXY(x1, (spage + 1) * 8);
+				glcd_Device::ReadDataBurst(hbuf, n);
+			}
+		}
+
+		for(i = 0; i < n; i++)
+		{
+			uint8_t data = color & fill;
+
+			if(keep)
+				data |= dbuf[i] & keep;
+			if(move)
+				data |= ((lbuf[i] | (hbuf[i] << 8)) >> sbits) & move;
+			dbuf[i] = data;
+		}
+
+		glcd_Device::GotoXY(x1, page * 8);
+		glcd_Device::WriteDataBurst(dbuf, n);
+
+		if(x2 - x1 < n)
+			break;	// done, also avoids x1 wrapping past the largest coordinate
+		x1 += n;
+	}
+}
+
 /*
  * Scroll a pixel region up.
  * 	Area scrolled is defined by x1,y1 through x2,y2 inclusive.
@@ -271,14 +370,10 @@ TareaToken tok;
  *  not 1 less or 1 more than what you want. It is *exact*.
  */
 
-void gText::ScrollUp(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, 
+void gText::ScrollUp(glcdCoord_t x1, glcdCoord_t y1, glcdCoord_t x2, glcdCoord_t y2, 
 	uint8_t pixels, uint8_t color)
 {
-uint8_t dy;
-uint8_t dbyte;
-uint8_t sy;
-uint8_t sbyte;
-uint8_t col;
+uint8_t page;
 
 	/*
 	 * Scrolling up more than area height?
@@ -293,111 +388,37 @@ uint8_t col;
 		return;
 	}
 
-	for(col = x1; col <= x2; col++)
+#ifdef GLCD_HW_SCROLL
+	/*
+	 * Scrolling the full display by whole pages is done
+	 * by moving the display start line rather than the pixels.
+	 */
+	if(!(pixels & 7) && (x1 == 0) && (y1 == 0) && (x2 == DISPLAY_WIDTH-1) && (y2 == DISPLAY_HEIGHT-1))
 	{
-		dy = y1;
-		glcd_Device::GotoXY(col, dy & ~7);
-		dbyte = glcd_Device::ReadData();
-
-
-		/*
-		 * preserve bits outside/above scroll region
-		 */
-
-		dbyte &= (_BV((dy & 7)) - 1);
-
-		sy = dy + pixels;
-		glcd_Device::GotoXY(col, sy & ~7);
-		sbyte = glcd_Device::ReadData();
-
-		while(sy <= y2)
-		{
-			if(sbyte & _BV(sy & 7))
-			{
-				dbyte |= _BV(dy & 7);
-			}
-
-			sy++;
-			if((sy & 7) == 0)
-			{
-				/*
-				 * If we just crossed over, then we should be done.
-				 */
-				if(sy < DISPLAY_HEIGHT)
-				{
-					glcd_Device::GotoXY(col, sy & ~7);
-					sbyte = glcd_Device::ReadData();
-				}
-			}
-
-			if((dy & 7) == 7)
-			{
-				glcd_Device::GotoXY(col, dy & ~7);	// Should be able to remove this
-				glcd_Device::WriteData(dbyte);
-				dbyte = 0;
-			}
-			dy++;
-		}
-
-		/*
-		 * Handle the new area at the bottom of the region
-		 */
-
-		for(uint8_t p = pixels; p; p--)
-		{
-			if(color == BLACK)
-			{
-				dbyte |= _BV(dy & 7);
-			}
-			else
-			{
-				dbyte &= ~_BV(dy & 7);
-			}
-
-			if((dy & 7) == 7)
-			{
-				glcd_Device::GotoXY(col, dy & ~7); // should be able to remove this.
-				glcd_Device::WriteData(dbyte);
-				dbyte = 0;
-			}
-			dy++;
-		}
-
-		/*
-		 * Flush out the final destination byte
-		 */
-
-
-		if(dy & 7)
-		{
-			dy--;
-
-			glcd_Device::GotoXY(col, dy & ~7);
-			sbyte = glcd_Device::ReadData();
-			/*
-			 * Preserver bits outside/below region
-			 */
-
-			dy++;
-			sbyte &= ~(_BV((dy & 7)) - 1);
-			dbyte |= sbyte;
-
-			glcd_Device::WriteData(dbyte);
-		}
+		glcd_Device::ScrollPages(pixels/8, color);
+		return;
 	}
+#endif
 
+	/*
+	 * Process region from top to bottom so that the source pages
+	 * below each page have not been modified yet when they are read.
+	 */
+	for(page = y1/8; page <= y2/8; page++)
+	{
+		this->ScrollPage(x1, x2, page, page * 8 + pixels,
+			~PageRowMask(page, y1, y2),			// preserve bits outside region
+			PageRowMask(page, y2 - pixels + 1, y2),	// new area at the bottom
+			color);
+	}
 }
 
 #ifndef GLCD_NO_SCROLLDOWN
 
-void gText::ScrollDown(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, 
+void gText::ScrollDown(glcdCoord_t x1, glcdCoord_t y1, glcdCoord_t x2, glcdCoord_t y2, 
 	uint8_t pixels, uint8_t color)
 {
-uint8_t dy;
-uint8_t dbyte;
-uint8_t sy;
-uint8_t sbyte;
-uint8_t col;
+uint8_t page;
 
 	/*
 	 * Scrolling up more than area height?
@@ -412,94 +433,26 @@ uint8_t col;
 		return;
 	}
 
-	/*
-	 * Process region from left to right
-	 */
-	for(col = x1; col <= x2; col++)
+#ifdef GLCD_HW_SCROLL
+	if(!(pixels & 7) && (x1 == 0) && (y1 == 0) && (x2 == DISPLAY_WIDTH-1) && (y2 == DISPLAY_HEIGHT-1))
 	{
-		dy = y2;
-		glcd_Device::GotoXY(col, dy & ~7);
-		dbyte = glcd_Device::ReadData();
-
-		/*
-		 * preserve bits outside/below scroll region
-		 */
-
-		dbyte &= ~(_BV(((dy & 7)+1)) - 1);
-		sy = dy - pixels;
-		glcd_Device::GotoXY(col, sy & ~7);
-		sbyte = glcd_Device::ReadData();
-
-		while(sy >= y1)
-		{
-			if(sbyte & _BV(sy & 7))
-			{
-				dbyte |= _BV(dy & 7);
-			}
-			if((dy & 7) == 0)
-			{
-				glcd_Device::GotoXY(col, dy & ~7);	// Should be able to remove this
-				glcd_Device::WriteData(dbyte);
-				dbyte = 0;
-			}
-			dy--;
-
-			if(!sy)
-				break; /* if we bottomed out, we are done */
-			sy--;
-			if((sy & 7) == 7)
-			{
-				glcd_Device::GotoXY(col, sy & ~7);
-				sbyte = glcd_Device::ReadData();
-			}
-
-		}
-
-		/*
-		 * Handle the new area at the top of the column
-		 */
-
-		for(uint8_t p = pixels; p; p--)
-		{
-			if(color == BLACK)
-			{
-				dbyte |= _BV(dy & 7);
-			}
-			else
-			{
-				dbyte &= ~_BV(dy & 7);
-			}
-
-			if((dy & 7) == 0)
-			{
-				glcd_Device::GotoXY(col, dy & ~7); // should be able to remove this.
-				glcd_Device::WriteData(dbyte);
-				dbyte = 0;
-			}
-			dy--;
-		}
-
-		dy++; /* point dy back to last destination row */
-
-		/*
-		 * Flush out the final destination byte
-		 */
-
-		if(dy & 7)
-		{
-			glcd_Device::GotoXY(col, dy & ~7);
-			sbyte = glcd_Device::ReadData();
-			/*
-			 * Preserve bits outside/above region
-			 */
-
-			sbyte &= (_BV((dy & 7)) - 1);
-			dbyte |= sbyte;
-			glcd_Device::WriteData(dbyte);
-		}
-
+		glcd_Device::ScrollPages(-(pixels/8), color);
+		return;
 	}
+#endif
 
+	/*
+	 * Process region from bottom to top so that the source pages
+	 * above each page have not been modified yet when they are read.
+	 */
+	page = y2/8;
+	do
+	{
+		this->ScrollPage(x1, x2, page, page * 8 - pixels,
+			~PageRowMask(page, y1, y2),			// preserve bits outside region
+			PageRowMask(page, y1, y1 + pixels - 1),	// new area at the top
+			color);
+	} while(page-- > y1/8);
 }
 #endif //GLCD_NO_SCROLLDOWN
 
@@ -865,7 +818,7 @@ int gText::PutChar(uint8_t c)
 
 	uint8_t pixels = height +1; /* 1 for gap below character*/
 	uint8_t p;
-	uint8_t dy;
+	glcdCoord_t dy;
 	uint8_t tfp;
 	uint8_t dp;
 	uint8_t dbyte;
@@ -1134,7 +1087,7 @@ void gText::Puts(char *str)
  */
 void gText::Puts(const String &str)
 {
-	for (int i = 0; i < str.length(); i++)
+	for (unsigned int i = 0; i < str.length(); i++)
 	{
 		write(str[i]);
 	}
@@ -1190,7 +1143,7 @@ uint8_t c;
  * @see write()
  */
 
-void gText::DrawString(char *str, uint8_t x, uint8_t y)
+void gText::DrawString(char *str, glcdCoord_t x, glcdCoord_t y)
 {
 	this->CursorToXY(x,y);
 	this->Puts(str);
@@ -1218,7 +1171,7 @@ void gText::DrawString(char *str, uint8_t x, uint8_t y)
  * @see DrawString_P()
  * @see write()
  */
-void gText::DrawString(String &str, uint8_t x, uint8_t y)
+void gText::DrawString(String &str, glcdCoord_t x, glcdCoord_t y)
 {
 	this->CursorToXY(x,y);
 	this->Puts(str);
@@ -1247,7 +1200,7 @@ void gText::DrawString(String &str, uint8_t x, uint8_t y)
  * @see write()
  */
 
-void gText::DrawString_P(PGM_P str, uint8_t x, uint8_t y)
+void gText::DrawString_P(PGM_P str, glcdCoord_t x, glcdCoord_t y)
 {
 	this->CursorToXY(x,y);
 	this->Puts_P(str);
@@ -1353,7 +1306,7 @@ void gText::CursorTo( int8_t column)
  * @see CursorTo()
  */
 
-void gText::CursorToXY( uint8_t x, uint8_t y)
+void gText::CursorToXY( glcdCoord_t x, glcdCoord_t y)
 {
 
 	/*
@@ -1393,8 +1346,8 @@ void gText::CursorToXY( uint8_t x, uint8_t y)
 void gText::EraseTextLine( eraseLine_t type) 
 {
 
-	uint8_t x = this->x;
-	uint8_t y = this->y;
+	glcdCoord_t x = this->x;
+	glcdCoord_t y = this->y;
 	uint8_t height = FontRead(this->Font+FONT_HEIGHT);
 	uint8_t color = (this->FontColor == BLACK) ? WHITE : BLACK;
 
@@ -1609,7 +1562,7 @@ uint16_t gText::StringWidth_P(String &str)
 {
 	uint16_t width = 0;
 
-	for (int i = 0; i < str.length(); i++)
+	for (unsigned int i = 0; i < str.length(); i++)
 	{
 		width += this->CharWidth(str[i]);
 	}
@@ -107,7 +107,7 @@ void glcd::ClearScreen(uint8_t color){
 #define _GLCD_swap(a,b) \
 do\
 {\
-uint8_t t;\
+glcdCoord_t t;\
 	t=a;\
 	a=b;\
 	b=t;\
@@ -131,10 +131,11 @@ uint8_t t;\
  *
  */
 
-void glcd::DrawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t color)
+void glcd::DrawLine(glcdCoord_t x1, glcdCoord_t y1, glcdCoord_t x2, glcdCoord_t y2, uint8_t color)
 {
-uint8_t deltax, deltay, x,y, steep;
-int8_t error, ystep;
+glcdCoord_t deltax, deltay, x,y;
+uint8_t steep;
+glcdDelta_t error, ystep;
 
 #ifdef XXX
 	/*
@@ -211,7 +212,7 @@ int8_t error, ystep;
  * @see DrawRoundRect()
  */
 
-void glcd::DrawRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t color) {
+void glcd::DrawRect(glcdCoord_t x, glcdCoord_t y, glcdCoord_t width, glcdCoord_t height, uint8_t color) {
 	DrawHLine(x, y, width, color);				// top
 	DrawHLine(x, y+height, width, color);		// bottom
 	DrawVLine(x, y, height, color);			    // left
@@ -237,7 +238,7 @@ void glcd::DrawRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t
  * @see DrawRect()
  */
 
-void glcd::DrawRoundRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t radius, uint8_t color) {
+void glcd::DrawRoundRect(glcdCoord_t x, glcdCoord_t y, glcdCoord_t width, glcdCoord_t height, uint8_t radius, uint8_t color) {
   	int16_t tSwitch; 
 	uint8_t x1 = 0, y1 = radius;
   	tSwitch = 3 - 2 * radius;
@@ -304,7 +305,7 @@ void glcd::DrawRoundRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, ui
  * @see InvertRect()
  */
 
-void glcd::FillRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t color) {
+void glcd::FillRect(glcdCoord_t x, glcdCoord_t y, glcdCoord_t width, glcdCoord_t height, uint8_t color) {
     this->SetPixels(x,y,x+width,y+height,color);
 }
 
@@ -331,8 +332,9 @@ void glcd::FillRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t
  */
 
 
-void glcd::InvertRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
-	uint8_t mask, pageOffset, h, i, data, tmpData;
+void glcd::InvertRect(glcdCoord_t x, glcdCoord_t y, glcdCoord_t width, glcdCoord_t height) {
+	uint8_t mask, pageOffset;
+	glcdCoord_t h;
 	height++;
 	
 	pageOffset = y%8;
@@ -350,12 +352,7 @@ void glcd::InvertRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
 	 * First do the fractional pages at the top of the region
 	 */
 	glcd_Device::GotoXY(x, y);
-	for(i=0; i<=width; i++) {
-		data = this->ReadData();
-		tmpData = ~data;
-		data = (tmpData & mask) | (data & ~mask);
-		this->WriteData(data);
-	}
+	this->UpdateDataBurst(width+1, 0xFF, mask);
 	
 	/*
 	 * Now do the full pages
@@ -364,11 +361,7 @@ void glcd::InvertRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
 		h += 8;
 		y += 8;
 		glcd_Device::GotoXY(x, y);
-		
-		for(i=0; i<=width; i++) {
-			data = this->ReadData();
-			this->WriteData(~data);
-		}
+		this->UpdateDataBurst(width+1, 0xFF, 0xFF);
 	}
 	
 	/*
@@ -377,13 +370,7 @@ void glcd::InvertRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
 	if(h < height) {
 		mask = ~(0xFF << (height-h));
 		glcd_Device::GotoXY(x, y+8);
-		
-		for(i=0; i<=width; i++) {
-			data = this->ReadData();
-			tmpData = ~data;
-			data = (tmpData & mask) | (data & ~mask);
-			this->WriteData(data);
-		}
+		this->UpdateDataBurst(width+1, 0xFF, mask);
 	}
 }
 /**
@@ -399,10 +386,14 @@ void glcd::InvertRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
 
 void glcd::SetDisplayMode(uint8_t invert) {  // was named SetInverted
 
+#ifdef GLCD_PAGE_BAND
+	this->Inverted = invert;	// nothing to invert, the next picture is drawn in the new mode
+#else
 	if(this->Inverted != invert) {
 		this->InvertRect(0,0,DISPLAY_WIDTH-1,DISPLAY_HEIGHT-1);
 		this->Inverted = invert;
 	}
+#endif
 }
 
 /**
@@ -423,9 +414,9 @@ void glcd::SetDisplayMode(uint8_t invert) {  // was named SetInverted
 #endif
  */
 
-void glcd::DrawBitmap(Image_t bitmap, uint8_t x, uint8_t y, uint8_t color){
+void glcd::DrawBitmap(Image_t bitmap, glcdCoord_t x, glcdCoord_t y, uint8_t color){
 uint8_t width, height;
-uint8_t i, j;
+uint8_t j;
 
   width = ReadPgmData(bitmap++); 
   height = ReadPgmData(bitmap++);
@@ -460,13 +451,8 @@ uint8_t i, j;
 
   for(j = 0; j < height / 8; j++) {
      glcd_Device::GotoXY(x, y + (j*8) );
-	 for(i = 0; i < width; i++) {
-		 uint8_t displayData = ReadPgmData(bitmap++);
-	   	 if(color == BLACK)
-			this->WriteData(displayData);
-		 else
-		    this->WriteData(~displayData);
-	 }
+	 this->WriteDataBurst_P(bitmap, width, color);
+	 bitmap += width;
   }
 }
 
@@ -491,7 +477,7 @@ uint8_t i, j;
  * @see DrawBitmap()
  */
 
-void glcd::DrawBitmapXBM(ImageXBM_t bitmapxbm, uint8_t x, uint8_t y, uint8_t color)
+void glcd::DrawBitmapXBM(ImageXBM_t bitmapxbm, glcdCoord_t x, glcdCoord_t y, uint8_t color)
 {
 uint8_t width, height;
 uint8_t bg_color;
@@ -580,7 +566,7 @@ uint8_t xbmdata;
  */
  
 
-void glcd::DrawVLine(uint8_t x, uint8_t y, uint8_t height, uint8_t color){
+void glcd::DrawVLine(glcdCoord_t x, glcdCoord_t y, glcdCoord_t height, uint8_t color){
   // this->FillRect(x, y, 0, length, color);
    this->SetPixels(x,y,x,y+height,color);
 }
@@ -603,7 +589,7 @@ void glcd::DrawVLine(uint8_t x, uint8_t y, uint8_t height, uint8_t color){
  * @see DrawVLine()
  */
 
-void glcd::DrawHLine(uint8_t x, uint8_t y, uint8_t width, uint8_t color){
+void glcd::DrawHLine(glcdCoord_t x, glcdCoord_t y, glcdCoord_t width, uint8_t color){
    // this->FillRect(x, y, length, 0, color);
     this->SetPixels(x,y, x+width, y, color);
 }
@@ -628,7 +614,7 @@ void glcd::DrawHLine(uint8_t x, uint8_t y, uint8_t width, uint8_t color){
  *
  * @see FillCircle()
  */
-void glcd::DrawCircle(uint8_t xCenter, uint8_t yCenter, uint8_t radius, uint8_t color){
+void glcd::DrawCircle(glcdCoord_t xCenter, glcdCoord_t yCenter, uint8_t radius, uint8_t color){
    this->DrawRoundRect(xCenter-radius, yCenter-radius, 2*radius, 2*radius, radius, color);
 }
 
@@ -651,7 +637,7 @@ void glcd::DrawCircle(uint8_t xCenter, uint8_t yCenter, uint8_t radius, uint8_t
  *
  */
 
-void glcd::FillCircle(uint8_t xCenter, uint8_t yCenter, uint8_t radius, uint8_t color)
+void glcd::FillCircle(glcdCoord_t xCenter, glcdCoord_t yCenter, uint8_t radius, uint8_t color)
 {
 /*
  * Circle fill Code is merely a modification of the midpoint
@@ -738,7 +724,7 @@ uint8_t ReadPgmData(const uint8_t* ptr)  // note this is a static function
 // override GotoXY to also call CursorToxy for backward compability 
 // with older v2 ks0108 library
 // (older library didn't have seperate x & y for hardware/graphics vs text )
-void glcd::GotoXY(uint8_t x, uint8_t y)
+void glcd::GotoXY(glcdCoord_t x, glcdCoord_t y)
 {
 	glcd_Device::GotoXY(x, y);
   	CursorToXY(x,y); 
@@ -79,19 +79,19 @@ class glcd : public gText
 /*@{*/
 	// Graphic Functions
 	void ClearScreen(uint8_t color = WHITE);
-	void DrawVLine(uint8_t x, uint8_t y, uint8_t height, uint8_t color= BLACK);
-	void DrawHLine(uint8_t x, uint8_t y, uint8_t width, uint8_t color= BLACK);
-	void DrawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t color= BLACK);
-	void DrawRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t color= BLACK);
-	void DrawRoundRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t radius, uint8_t color= BLACK);
-	void FillRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t color= BLACK);
-	void InvertRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
-	void DrawCircle(uint8_t xCenter, uint8_t yCenter, uint8_t radius, uint8_t color= BLACK);	
-	void FillCircle(uint8_t xCenter, uint8_t yCenter, uint8_t radius, uint8_t color= BLACK);	
-	void DrawBitmap(Image_t bitmap, uint8_t x, uint8_t y, uint8_t color= BLACK);
+	void DrawVLine(glcdCoord_t x, glcdCoord_t y, glcdCoord_t height, uint8_t color= BLACK);
+	void DrawHLine(glcdCoord_t x, glcdCoord_t y, glcdCoord_t width, uint8_t color= BLACK);
+	void DrawLine(glcdCoord_t x1, glcdCoord_t y1, glcdCoord_t x2, glcdCoord_t y2, uint8_t color= BLACK);
+	void DrawRect(glcdCoord_t x, glcdCoord_t y, glcdCoord_t width, glcdCoord_t height, uint8_t color= BLACK);
+	void DrawRoundRect(glcdCoord_t x, glcdCoord_t y, glcdCoord_t width, glcdCoord_t height, uint8_t radius, uint8_t color= BLACK);
+	void FillRect(glcdCoord_t x, glcdCoord_t y, glcdCoord_t width, glcdCoord_t height, uint8_t color= BLACK);
+	void InvertRect(glcdCoord_t x, glcdCoord_t y, glcdCoord_t width, glcdCoord_t height);
+	void DrawCircle(glcdCoord_t xCenter, glcdCoord_t yCenter, uint8_t radius, uint8_t color= BLACK);	
+	void FillCircle(glcdCoord_t xCenter, glcdCoord_t yCenter, uint8_t radius, uint8_t color= BLACK);	
+	void DrawBitmap(Image_t bitmap, glcdCoord_t x, glcdCoord_t y, uint8_t color= BLACK);
 #ifdef NOTYET
-	void DrawBitmapXBM(ImageXBM_t bitmapxbm, uint8_t x, uint8_t y, uint8_t color= BLACK);
-	void DrawBitmapXBM_P(uint8_t width, uint8_t height, uint8_t *xbmbits, uint8_t x, uint8_t y, 
+	void DrawBitmapXBM(ImageXBM_t bitmapxbm, glcdCoord_t x, glcdCoord_t y, uint8_t color= BLACK);
+	void DrawBitmapXBM_P(uint8_t width, uint8_t height, uint8_t *xbmbits, glcdCoord_t x, glcdCoord_t y, 
 		uint8_t fg_color, uint8_t bg_color);
 #endif
 
@@ -100,31 +100,70 @@ class glcd : public gText
 	 * Define functions to get them to show up properly
 	 * in doxygen
 	 */
-	void SetDot(uint8_t x, uint8_t y, uint8_t color);
-	void SetPixels(uint8_t x, uint8_t y,uint8_t x1, uint8_t y1, uint8_t color);
+	void SetDot(glcdCoord_t x, glcdCoord_t y, uint8_t color);
+	void SetPixels(glcdCoord_t x, glcdCoord_t y,glcdCoord_t x1, glcdCoord_t y1, uint8_t color);
 	uint8_t ReadData(void);        // now public
     void WriteData(uint8_t data); 
+	void WriteDataBurst(const uint8_t *buf, glcdCoord_t n, uint8_t color = BLACK);
+	void WriteDataBurst_P(const uint8_t *buf, glcdCoord_t n, uint8_t color = BLACK);
+	void ReadDataBurst(uint8_t *buf, glcdCoord_t n);
+	void Flush(void);
+	uint8_t FlushStep(void);
+	uint16_t FlushPending(void);
+	void Present(void);
+	void SetFrameRate(uint8_t fps);
+	void FirstBand(void);
+	uint8_t NextBand(void);
+	uint8_t GetError(void);
 #else
 	using glcd_Device::SetDot;
 	using glcd_Device::SetPixels;
 	using glcd_Device::ReadData; 
 	using glcd_Device::WriteData; 
+	using glcd_Device::WriteDataBurst; 
+	using glcd_Device::WriteDataBurst_P; 
+	using glcd_Device::ReadDataBurst; 
+	using glcd_Device::Flush; 
+	using glcd_Device::FlushStep; 
+	using glcd_Device::FlushPending; 
+	using glcd_Device::Present; 
+	using glcd_Device::SetFrameRate; 
+	using glcd_Device::GetError; 
+#endif
+#ifdef GLCD_WRITE_COUNTS
+	using glcd_Device::WritesSent;
+	using glcd_Device::WritesSkipped;
+#endif
+#ifdef GLCD_BUS_TRACE
+	using glcd_Device::TraceDump;
+	using glcd_Device::TraceMark;
+#endif
+#ifdef GLCD_STATS
+	using glcd_Device::GetStats;
+	using glcd_Device::ResetStats;
+#endif
+#if glcd_PANEL_COUNT > 1
+	using glcd_Device::SelectPanel;
+#endif
+#if defined(GLCD_PAGE_BAND) && !defined(DOXYGEN)
+	using glcd_Device::FirstBand;
+	using glcd_Device::NextBand;
 #endif
 
 
 
-	void GotoXY(uint8_t x, uint8_t y);  // overrride for GotoXY in device class
+	void GotoXY(glcdCoord_t x, glcdCoord_t y);  // overrride for GotoXY in device class
 
 
 /*@}*/
 
 	//Device Properties - these are read only constants	 
-	static const uint8_t Width = DISPLAY_WIDTH; 	/**< Display width in pixels */
-	static const uint8_t Height = DISPLAY_HEIGHT;	/**< Display height in pixels */
-	static const uint8_t Right = DISPLAY_WIDTH-1;	/**< Right most pixel on Display (equals Width -1)*/
-	static const uint8_t Bottom = DISPLAY_HEIGHT-1; /**< Bottom most pixel on Display (equals Height -1)*/
-	static const uint8_t CenterX = DISPLAY_WIDTH/2;	/**< Horizontal center pixel on Display (equals Width/2)*/
-	static const uint8_t CenterY = DISPLAY_HEIGHT/2;/**< Vertical center pixel on Display (equals Height/2)*/
+	static const glcdCoord_t Width = DISPLAY_WIDTH; 	/**< Display width in pixels */
+	static const glcdCoord_t Height = DISPLAY_HEIGHT;	/**< Display height in pixels */
+	static const glcdCoord_t Right = DISPLAY_WIDTH-1;	/**< Right most pixel on Display (equals Width -1)*/
+	static const glcdCoord_t Bottom = DISPLAY_HEIGHT-1; /**< Bottom most pixel on Display (equals Height -1)*/
+	static const glcdCoord_t CenterX = DISPLAY_WIDTH/2;	/**< Horizontal center pixel on Display (equals Width/2)*/
+	static const glcdCoord_t CenterY = DISPLAY_HEIGHT/2;/**< Vertical center pixel on Display (equals Height/2)*/
 	
 };
 
@@ -76,6 +76,8 @@
  */
 
 //#include "config/ks0108_Manual_Config.h"       // generic ks0108 configuration
+//#include "config/ks0108_SPI_Manual_Config.h"   // ks0108 through 74HC595 shift registers on the SPI pins
+//#include "config/ks0108_I2C_Manual_Config.h"   // ks0108 through a MCP23017 I2C port expander
 
 //#include "config/Modadm12864f_Manual_Config.h" // configuration for BGMicro 128x64 display with pinout diagram
 //#include "config/Modvk5121_Manual_Config.h"    // configuration for vk5121 122x32 display with pinout diagram
@@ -96,6 +98,11 @@
 
 //#define GLCD_NODEFER_SCROLL    // uncomment to disable deferred newline processing
 
+//#define GLCD_NO_HWSCROLL       // uncomment to always scroll text by moving pixels
+				// Normally text areas that cover the full display and scroll by
+				// whole LCD pages (8 pixel rows) are scrolled by moving the glcd
+				// display start line which only needs the new line to be cleared.
+
 //#define GLCD_NOINIT_CHECKS	// uncommont to remove initialization busy status checks
 				// this turns off the code in the low level init code that
 				// checks for a module stuck BUSY or stuck in RESET.
@@ -108,6 +115,106 @@
 				// will use DISPLAY_HEIGHT/8 * DISPLAY_WIDTH bytes of RAM
 				// A typical 128x64 ks0108 will use 1k of RAM for this.
 				// performance increase is quite noticeable (double or so on FPS test)
+				// Data writes that would not change glcd memory are skipped.
 				// This will not work on smaller AVRs like the mega168 that only
 				// have 1k of RAM total.
+
+//#define GLCD_PAGE_CACHE 2	// Turns on a partial read cache of this many LCD pages
+				// for AVRs that can't spare the RAM for GLCD_READ_CACHE.
+				// Uses GLCD_PAGE_CACHE * (DISPLAY_WIDTH + DISPLAY_WIDTH/8 + 2) bytes of RAM,
+				// 292 bytes for 2 pages of a 128x64 ks0108 (4 pages is 584).
+				// Bytes that were read or written are read back from the cache,
+				// the least recently used page is dropped when another page is needed.
+				// Every write still goes to the display so only data reads are saved.
+				// With GLCD_STATS, GLCD.GetStats() also returns the cache hits,
+				// misses and pages replaced.
+				// Can't be used with GLCD_READ_CACHE or GLCD_PAGE_BAND.
+
+//#define GLCD_RLE_CACHE 340	// Turns on a read cache of the whole display kept run length
+				// encoded in a pool of this many bytes (plus 2 bytes per LCD page and 2),
+				// for screens that are mostly blank: 340 bytes is a third of what
+				// GLCD_READ_CACHE needs on a 128x64 ks0108.
+				// A page that no longer compresses is kept as raw bytes and a page that
+				// doesn't fit in the pool is read from the display until it is cleared.
+				// Every write still goes to the display so only data reads are saved.
+				// Can't be used with GLCD_READ_CACHE, GLCD_PAGE_CACHE or GLCD_PAGE_BAND.
+
+//#define GLCD_WRITEBACK_CACHE  // Turns on code that draws only into the frame buffer
+				// The display is not updated until GLCD.Flush() is called
+				// which sends only the columns written since the last Flush().
+				// This automatically turns on GLCD_READ_CACHE and uses the
+				// same RAM plus 2 bytes per LCD page to track the dirty columns.
+
+//#define GLCD_DOUBLE_BUFFER    // Turns on double buffering for tear free animation
+				// Drawing goes to the frame buffer and the display is only changed by
+				// GLCD.Present() (or GLCD.Flush()) which sends only the columns
+				// that differ from what the display already shows.
+				// GLCD.SetFrameRate(fps) limits how often GLCD.Present() updates the display.
+				// This automatically turns on GLCD_WRITEBACK_CACHE and uses another
+				// DISPLAY_HEIGHT/8 * DISPLAY_WIDTH bytes of RAM for the front buffer
+				// (2k total for a 128x64 panel) so it needs an AVR like the mega1280/2560.
+				// Can't be used with GLCD_ASYNC_FLUSH.
+
+//#define GLCD_ASYNC_FLUSH      // Turns on sending the write back cache frame buffer to the display
+				// from a timer interrupt while the sketch keeps drawing.
+				// This automatically turns on GLCD_WRITEBACK_CACHE.
+				// Each interrupt sends at most GLCD_FLUSH_CHUNK (8) columns,
+				// GLCD_ASYNC_HZ (2000) times a second.
+				// GLCD.FlushPending() returns the number of columns still to send
+				// and GLCD.Flush() waits until the display is up to date.
+				// On AVR timer2 is used so tone() and PWM on the timer2 pins can't be used.
+				// Without timer2, call glcd_FlushISR() from your own timer interrupt.
+				// If any glcd pin shares a port with pins written by the sketch,
+				// GLCD_ATOMIC_IO must also be turned on.
+
+//#define GLCD_BUSYMODE GLCD_BUSY_TIMED	// Selects how the code waits for the glcd to finish an operation
+				// GLCD_BUSY_STATUS (default) polls the status before every access.
+				// GLCD_BUSY_TIMED never reads the status and instead makes sure the worst
+				// case busy time from the device header has elapsed since the chip was
+				// last strobed.
+				// GLCD_BUSY_HYBRID only polls the status when that time may not have elapsed.
+				// The busy times (GLCD_tBUSY_CMD/GLCD_tBUSY_DATA) can be set in the panel config.
+				// GLCD_BUSY_ADAPTIVE polls the status while GLCD.Init() accesses each chip
+				// back to back and from then on only polls the chips that were ever found busy,
+				// others are polled every GLCD_BUSY_CHECK (16) accesses and go back to being
+				// polled every access if they are ever found busy.
+				// In all modes that poll, a chip that stays busy for GLCD_BUSY_TIMEOUT (2000)
+				// polls is given up on and GLCD.GetError() returns GLCD_EBUSY.
+
+//#define GLCD_WRITE_COUNTS	// Turns on counting of data bytes sent to the glcd (GLCD.WritesSent)
+				// and data bytes that were not sent because the read cache showed
+				// the glcd memory already had them (GLCD.WritesSkipped).
+				// Uses 8 bytes of RAM.
+
+//#define GLCD_BUS_TRACE	// Turns on recording of every glcd bus transaction (commands,
+				// data writes, data reads and status reads) in a ring buffer
+				// of GLCD_TRACE_SIZE (256) bytes, 2 bytes per transaction.
+				// GLCD.TraceDump(Serial) sends the binary trace and empties the buffer,
+				// GLCD.TraceMark(id) labels the transactions that follow.
+				// When the buffer fills the oldest transactions are dropped and counted.
+				// The glcdtrace tool in debug/host replays a trace and reports
+				// redundant commands, read/write ratios and per chip hotspots.
+
+//#define GLCD_STATS		// Turns on counting of glcd bus operations: commands (page, column
+				// and other), data reads (dummy reads counted separately), data writes
+				// (writes of bytes merged for a y not on a page boundary counted
+				// separately), chip switches and busy status polls.
+				// GLCD.GetStats() returns the counters and a histogram per chip
+				// of the polls each busy wait took, GLCD.ResetStats() clears them.
+				// GLCDdiags prints them for each drawing primitive.
+				// Uses 40 bytes of RAM plus 16 per chip and slows every bus access a little.
+
+//#define GLCD_WIDE_COORDS	// Turns on 16 bit pixel coordinates (glcdCoord_t)
+				// This is automatic for displays more than 255 pixels wide or high,
+				// which can have up to 8 chips. It only needs to be set by hand to
+				// check a smaller panel with the wide code, it is bigger and slower.
+
+//#define GLCD_PAGE_BAND 1	// Turns on picture loop drawing for boards without the RAM for the
+				// read cache: the sketch draws its whole picture between GLCD.FirstBand()
+				// and GLCD.NextBand() once for every band of GLCD_PAGE_BAND glcd memory
+				// pages (8 pixel rows each) and each band is sent with sequential writes,
+				// the glcd is never read. Uses GLCD_PAGE_BAND * DISPLAY_WIDTH bytes of RAM
+				// (128 for a 128x64 ks0108 with 1 page) and more bands take fewer passes.
+				// Text areas can't scroll and hardware scrolling is not used.
+				// Can't be used with the read cache or with more than one panel.
 #endif
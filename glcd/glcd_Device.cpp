@@ -24,6 +24,7 @@
 
 */
 
+#include <avr/pgmspace.h>
 #include "include/glcd_Device.h"
 #include "include/glcd_io.h"
 #include "include/glcd_errno.h"
@@ -86,18 +87,671 @@ lcdCoord  glcd_Device::Coord;
 							// teensy GLCD adapter board which has a very slow rising reset pulse.
 
 
-//#define GLCD_XCOL_SUPPORT	//turns on code to track the hardware X/column to minimize set column commands.
-							// Believe it or not, the code on the ks0108s runs slower with this
-							// enabled.
+#ifdef GLCD_XCOL_SUPPORT
+/*
+ * Next hardware column after a data read or write.
+ *
+ * An unknown column (-1) stays unknown.
+ * A column past the last visible column is harmless as it never matches a
+ * column that GotoXY() wants, so only devices that wrap need to say so.
+ */
+#ifdef glcd_DevColWrap
+#define glcd_DevColNext(col)	((col) == (uint8_t)-1 ? (col) : ((col) + 1 == glcd_DevColWrap ? 0 : (col) + 1))
+#else
+#define glcd_DevColNext(col)	((col) == (uint8_t)-1 ? (col) : (col) + 1)
+#endif
+#endif
+
+
+#ifdef GLCD_HW_SCROLL
+/*
+ * The glcd memory page shown at the top of the display.
+ * The display is scrolled by moving the display start line,
+ * so s/w y coordinates are mapped to glcd memory pages relative to it.
+ */
+static uint8_t glcd_startpage;
+#ifdef GLCD_WRITEBACK_CACHE
+static uint8_t glcd_hwstartpage;	// start page the glcd was last sent
+#endif
+
+static inline uint8_t glcd_Page(glcdCoord_t y)
+{
+uint8_t page = y/8 + glcd_startpage;
+
+	if(page >= DISPLAY_HEIGHT/8)
+		page -= DISPLAY_HEIGHT/8;
+	return(page);
+}
 
+/*
+ * s/w y coordinate of the top of a glcd memory page
+ */
+static inline glcdCoord_t glcd_PageY(uint8_t page)
+{
+	if(page < glcd_startpage)
+		page += DISPLAY_HEIGHT/8;
+	return((page - glcd_startpage) * 8);
+}
+#else
+#define glcd_Page(y)	((y)/8)
+#define glcd_PageY(page)	((page)*8)
+#endif
+
+#if glcd_PANEL_COUNT > 1
+/*
+ * The panel being drawn on and the state of the other panels.
+ * The chips of every panel are numbered one after the other,
+ * glcd_panelchip is the number of the first chip of the panel.
+ * The page and column of every chip stay in Coord so switching panels
+ * doesn't lose what each chip is positioned at.
+ */
+static uint8_t glcd_panel;
+static uint8_t glcd_panelchip;
+static struct
+{
+	glcdCoord_t x;
+	glcdCoord_t y;
+	uint8_t inverted;
+#ifdef GLCD_HW_SCROLL
+	uint8_t startpage;
+#endif
+} glcd_panels[glcd_PANEL_COUNT];
+#else
+#define glcd_panelchip	0
+#endif
+
+/*
+ * chip of the current panel that shows x,y
+ */
+#define glcd_Chip(x, y)	(glcd_DevXYval2Chip(x, y) + glcd_panelchip)
 
 #ifdef GLCD_READ_CACHE
 /*
  * Declare a static buffer for the Frame buffer for the Read Cache
+ * (indexed by glcd memory page)
  */
 uint8_t glcd_rdcache[DISPLAY_HEIGHT/8][DISPLAY_WIDTH];
 #endif
 
+#ifdef GLCD_PAGE_BAND
+/*
+ * The page band, glcd memory pages glcd_bandpage on
+ * (raw display memory data, like the read cache)
+ */
+static uint8_t glcd_band[GLCD_PAGE_BAND][DISPLAY_WIDTH];
+static uint8_t glcd_bandpage;
+
+/*
+ * band row of the page that shows y, GLCD_PAGE_BAND or more when outside the band
+ */
+#define glcd_BandRow(y)	((uint8_t)(glcd_Page(y) - glcd_bandpage))
+#endif
+
+#ifdef GLCD_WRITEBACK_CACHE
+/*
+ * Dirty column span of each page in the frame buffer.
+ * A page is clean when its first dirty column is beyond its last dirty column.
+ */
+static glcdCoord_t glcd_dirtyx1[DISPLAY_HEIGHT/8];
+static glcdCoord_t glcd_dirtyx2[DISPLAY_HEIGHT/8];
+
+/*
+ * The span FlushStep() is sending
+ * Its dirty columns are taken from the page all at once, after that
+ * anything drawn in the span marks the page dirty again.
+ */
+static uint8_t glcd_flpage;		// glcd memory page of the span
+static glcdCoord_t glcd_flx;	// next column to send
+static glcdCoord_t glcd_flx2;	// last column to send (nothing to send when < glcd_flx)
+static uint8_t glcd_flchip;		// chip the glcd was positioned on for the span
+
+#ifdef GLCD_DOUBLE_BUFFER
+/*
+ * Front buffer, a copy of what is in glcd memory
+ * (the read cache frame buffer is the back buffer that is drawn into)
+ * Only columns that differ from it are sent.
+ */
+static uint8_t glcd_frontbuf[DISPLAY_HEIGHT/8][DISPLAY_WIDTH];
+#endif
+
+#ifdef GLCD_ASYNC_FLUSH
+/*
+ * device the flush interrupt sends for (set once Init() is done)
+ */
+static glcd_Device *glcd_flushdev;
+
+void glcd_FlushISR(void)
+{
+	if(glcd_flushdev)
+		glcd_flushdev->FlushStep();
+}
+
+#ifdef lcdAsyncTimerVect
+ISR(lcdAsyncTimerVect)
+{
+	glcd_FlushISR();
+}
+#endif
+#endif
+#elif defined(GLCD_READ_CACHE)
+/*
+ * display x and page the glcd hardware will write next
+ * The hardware is only repositioned when a byte that differs from the
+ * read cache must actually be written. (all ones means unknown)
+ */
+static glcdCoord_t glcd_hwx = (glcdCoord_t) -1;
+static uint8_t glcd_hwpage = 0xff;
+#endif
+
+#ifdef GLCD_RMW_MODE
+/*
+ * Read-modify-write mode state
+ *
+ * In RMW mode a data read does not advance the column, only a data write does.
+ * When a read is done at the column the previous write advanced to,
+ * it is part of a column sequential read/modify/write run so the chip is
+ * put in RMW mode and the rest of the run needs no set column commands.
+ * The column can't be set while in RMW mode and ending the mode
+ * returns the column to where it was when the mode started.
+ */
+static uint8_t glcd_rmwchips;					// bit for each chip in RMW mode
+static uint8_t glcd_rmwcol[glcd_TOTAL_CHIPS];	// column when RMW mode started
+static uint8_t glcd_colcmd;						// column was set since the last write
+#endif
+
+#if GLCD_BUSYMODE == GLCD_BUSY_TIMED || GLCD_BUSYMODE == GLCD_BUSY_HYBRID
+/*
+ * State for the timed busy modes:
+ * the timer tick of the last strobe to each chip and
+ * a bit for each chip whose last strobe was a command.
+ */
+#ifdef lcdTimerTicks
+static uint8_t glcd_busyts[glcd_TOTAL_CHIPS];
+#define glcd_BusyStamp(chip) glcd_busyts[chip] = lcdTimerTicks()
+
+/*
+ * busy times in timer ticks
+ * GLCD_tBUSY_CMD and GLCD_tBUSY_DATA are the worst case times in nanoseconds
+ * a chip stays busy after a command or data strobe. Each device header
+ * declares them and a panel config file can override them.
+ * GLCD_BUSY_TIMED waits them out instead of polling status and
+ * GLCD_BUSY_HYBRID only polls status when they may not have elapsed.
+ * The tick counter can advance just after a strobe, so a measured
+ * difference only guarantees one tick less than it says.
+ */
+#define GLCD_tBUSY_CMD_TICKS	((GLCD_tBUSY_CMD + lcdTimerTickNs - 1) / lcdTimerTickNs)
+#define GLCD_tBUSY_DATA_TICKS	((GLCD_tBUSY_DATA + lcdTimerTickNs - 1) / lcdTimerTickNs)
+#else
+#define glcd_BusyStamp(chip)
+#endif
+static uint8_t glcd_busycmd;
+
+#define glcd_BusyMark(chip, iscmd)				\
+do {											\
+	glcd_BusyStamp(chip);						\
+	if(iscmd)									\
+		glcd_busycmd |= _BV(chip);				\
+	else										\
+		glcd_busycmd &= ~_BV(chip);				\
+} while(0)
+#else
+#define glcd_BusyMark(chip, iscmd)
+#endif
+
+static uint8_t glcd_error;		// first error since the last GetError()
+
+#if GLCD_BUSYMODE == GLCD_BUSY_ADAPTIVE
+/*
+ * State for the adaptive busy mode:
+ * a bit for each chip a status poll found busy and
+ * a bit for each chip whose status polls are skipped.
+ * Init() polls every access and then skips the chips it never found busy.
+ */
+static uint8_t glcd_busyseen;
+static uint8_t glcd_busyskip;
+static uint8_t glcd_busychecks;		// counts accesses to chips that skip polls
+#endif
+
+/*
+ * Shadow of the bus state so that the data port direction and the
+ * DI/RW control lines are only touched when they actually change.
+ * (0x55 is not a valid value for either so it means unknown)
+ */
+static uint8_t glcd_busdir = 0x55;	// last data direction (0x00 input, 0xff output)
+static uint8_t glcd_busctl = 0x55;	// last DI/RW levels (bit 0 DI, bit 1 RW)
+
+#define glcd_BusDataDir(dirbits)				\
+do {											\
+	if(glcd_busdir != (dirbits))				\
+	{											\
+		glcd_busdir = (dirbits);				\
+		lcdDataDir(dirbits);					\
+	}											\
+} while(0)
+
+#define glcd_BusDIRW(di, rw)					\
+do {											\
+	if(glcd_busctl != (((di) ? 1 : 0) | ((rw) ? 2 : 0)))	\
+	{											\
+		glcd_busctl = ((di) ? 1 : 0) | ((rw) ? 2 : 0);		\
+		lcdfastWrite2(glcdDI, di, glcdRW, rw);	\
+	}											\
+} while(0)
+
+#ifdef GLCD_SPI_BUS
+/*
+ * shift register bus state (see glcd_io.h)
+ */
+uint8_t lcd_spictl;
+uint8_t lcd_spidata;
+uint8_t lcd_spidirty;
+#endif
+
+#ifdef GLCD_I2C_BUS
+/*
+ * I2C port expander bus state (see mcp23017_io.h)
+ */
+uint8_t lcd_i2cctl;
+uint8_t lcd_i2cdata;
+uint8_t lcd_i2csent;
+uint8_t lcd_i2copen;
+uint8_t lcd_i2cerror;
+#endif
+
+#ifdef GLCD_WRITE_COUNTS
+uint32_t glcd_Device::WritesSent;
+uint32_t glcd_Device::WritesSkipped;
+#endif
+
+#ifdef GLCD_BUS_TRACE
+/*
+ * Bus trace ring buffer
+ * The indexes run freely and are masked on use so that
+ * glcd_trin - glcd_trout is always the number of bytes in the buffer.
+ */
+static uint8_t glcd_trbuf[GLCD_TRACE_SIZE];
+static uint16_t glcd_trin;		// where the next record goes
+static uint16_t glcd_trout;		// oldest record
+static uint8_t glcd_trlost;		// records dropped since the last TraceDump()
+
+static void glcd_TraceRecord(uint8_t rec, uint8_t data)
+{
+#ifdef GLCD_ASYNC_FLUSH
+uint8_t sreg;
+
+	lcdIntSave(sreg);
+#endif
+	if((uint16_t)(glcd_trin - glcd_trout) >= GLCD_TRACE_SIZE)
+	{
+		glcd_trout += 2;		// drop the oldest record
+		if(glcd_trlost != 0xff)
+			glcd_trlost++;
+	}
+	glcd_trbuf[glcd_trin & (GLCD_TRACE_SIZE-1)] = rec;
+	glcd_trbuf[(glcd_trin+1) & (GLCD_TRACE_SIZE-1)] = data;
+	glcd_trin += 2;
+#ifdef GLCD_ASYNC_FLUSH
+	lcdIntRestore(sreg);
+#endif
+}
+#define glcd_Trace(type, chip, data)	glcd_TraceRecord((type) | (chip), data)
+#else
+#define glcd_Trace(type, chip, data)
+#endif
+
+#ifdef GLCD_STATS
+/*
+ * bus operation counters (see GetStats())
+ */
+static glcdStats_t glcd_stats;
+static uint8_t glcd_statchip;		// chip of the last access, glcd_TOTAL_CHIPS for all of them
+static uint8_t glcd_statunaligned;	// data writes are for a y that is not on a page boundary
+
+#define glcd_Stat(counter)	(glcd_stats.counter++)
+#define glcd_StatChip(chip)							\
+	do {											\
+		if((chip) != glcd_statchip)					\
+		{											\
+			glcd_statchip = (chip);					\
+			glcd_stats.chipswitches++;				\
+		}											\
+	} while(0)
+#define glcd_StatWrite()							\
+	do {											\
+		glcd_stats.writes++;						\
+		if(glcd_statunaligned)						\
+			glcd_stats.unaligned++;					\
+	} while(0)
+#define glcd_StatUnaligned(flag)	(glcd_statunaligned = (flag))
+
+/*
+ * count a busy wait that took polls polls in the chip's histogram
+ */
+static void glcd_StatBusy(uint8_t chip, uint16_t polls)
+{
+uint8_t bin = 0;
+
+	glcd_stats.busypolls += polls;
+	while(polls && bin < GLCD_BUSY_BINS-1)
+	{
+		polls >>= 1;
+		bin++;
+	}
+	if(glcd_stats.busyhist[chip][bin] != 0xffff)
+		glcd_stats.busyhist[chip][bin]++;
+}
+#else
+#define glcd_Stat(counter)
+#define glcd_StatChip(chip)
+#define glcd_StatWrite()
+#define glcd_StatUnaligned(flag)
+#endif
+
+#ifdef GLCD_PAGE_CACHE
+/*
+ * Partial read cache of GLCD_PAGE_CACHE glcd memory pages, least recently used
+ * page replaced first. A column of a page is only valid once it has been
+ * read from or written to the glcd. Every write still goes to the glcd, so
+ * a page is simply dropped when it is replaced.
+ */
+static uint8_t glcd_pcpage[GLCD_PAGE_CACHE];	// glcd memory page of each entry, 0xff when empty
+static uint8_t glcd_pcmru[GLCD_PAGE_CACHE];		// entries, most recently used first
+static uint8_t glcd_pcdata[GLCD_PAGE_CACHE][DISPLAY_WIDTH];
+static uint8_t glcd_pcvalid[GLCD_PAGE_CACHE][(DISPLAY_WIDTH+7)/8];	// bit for each valid column
+
+#define glcd_PcValid(e, x)	(glcd_pcvalid[e][(x)/8] & _BV((x)%8))
+#define glcd_PcSet(e, x, data)							\
+	do {												\
+		glcd_pcdata[e][x] = (data);						\
+		glcd_pcvalid[e][(x)/8] |= _BV((x)%8);			\
+	} while(0)
+
+/*
+ * empty every entry
+ */
+static void glcd_PcInvalidate(void)
+{
+	for(uint8_t e = 0; e < GLCD_PAGE_CACHE; e++)
+	{
+		glcd_pcpage[e] = 0xff;
+		glcd_pcmru[e] = e;
+	}
+}
+
+/*
+ * find the entry of a glcd memory page and make it the most recently used
+ *
+ * When the page is not cached and alloc is set, the least recently used
+ * entry is emptied and given to the page.
+ * Returns GLCD_PAGE_CACHE when the page is not cached.
+ */
+static uint8_t glcd_PcEntry(uint8_t page, uint8_t alloc)
+{
+uint8_t i, e;
+
+	for(i = 0; i < GLCD_PAGE_CACHE; i++)
+	{
+		if(glcd_pcpage[glcd_pcmru[i]] == page)
+			break;
+	}
+	if(i == GLCD_PAGE_CACHE)
+	{
+		if(!alloc)
+			return(GLCD_PAGE_CACHE);
+		i = GLCD_PAGE_CACHE-1;
+		e = glcd_pcmru[i];
+		if(glcd_pcpage[e] != 0xff)
+			glcd_Stat(cacheevictions);
+		glcd_pcpage[e] = page;
+		for(uint8_t b = 0; b < (DISPLAY_WIDTH+7)/8; b++)
+			glcd_pcvalid[e][b] = 0;
+	}
+	e = glcd_pcmru[i];
+	for(; i; i--)
+		glcd_pcmru[i] = glcd_pcmru[i-1];
+	glcd_pcmru[0] = e;
+	return(e);
+}
+#endif
+
+#ifdef GLCD_RLE_CACHE
+/*
+ * Read cache of the entire display kept run length encoded in a pool of
+ * GLCD_RLE_CACHE bytes. The glcd memory pages are stored one after another,
+ * each as (count, data) runs or, when the runs would take as much room,
+ * as DISPLAY_WIDTH raw bytes. A page that does not fit in the pool is not
+ * cached (no bytes) until it is filled again. Every write still goes to the glcd.
+ */
+static uint8_t glcd_rlepool[GLCD_RLE_CACHE];
+static uint16_t glcd_rleoff[DISPLAY_HEIGHT/8 + 1];	// start of each page, the last is the end of the used pool
+
+#define glcd_RleLen(page)	(glcd_rleoff[(page)+1] - glcd_rleoff[page])
+
+/*
+ * move the pool from pos to the end of the used pool by delta bytes,
+ * the pages after page move with it
+ * returns 0 when there is no room
+ */
+static uint8_t glcd_RleShift(uint8_t page, uint16_t pos, int16_t delta)
+{
+uint16_t end = glcd_rleoff[DISPLAY_HEIGHT/8];
+uint16_t i;
+
+	if(delta > 0)
+	{
+		if(end + delta > GLCD_RLE_CACHE)
+			return(0);
+		for(i = end; i-- > pos; )
+			glcd_rlepool[i + delta] = glcd_rlepool[i];
+	}
+	else
+	{
+		for(i = pos; i < end; i++)
+			glcd_rlepool[i + delta] = glcd_rlepool[i];
+	}
+	for(page++; page <= DISPLAY_HEIGHT/8; page++)
+		glcd_rleoff[page] += delta;
+	return(1);
+}
+
+/*
+ * stop caching a page
+ */
+static void glcd_RleDrop(uint8_t page)
+{
+	glcd_RleShift(page, glcd_rleoff[page+1], -(int16_t) glcd_RleLen(page));
+	glcd_Stat(cacheevictions);
+}
+
+/*
+ * empty the cache, no page is cached
+ */
+static void glcd_RleInvalidate(void)
+{
+	for(uint8_t page = 0; page <= DISPLAY_HEIGHT/8; page++)
+		glcd_rleoff[page] = 0;
+}
+
+/*
+ * cache a page that is filled with data
+ */
+static void glcd_RleFill(uint8_t page, uint8_t data)
+{
+uint16_t i;
+glcdCoord_t x;
+uint8_t count;
+
+	i = glcd_rleoff[page];
+	if(!glcd_RleShift(page, glcd_rleoff[page+1], 2 * ((DISPLAY_WIDTH + 254) / 255) - glcd_RleLen(page)))
+	{
+		glcd_RleDrop(page);
+		return;
+	}
+	for(x = DISPLAY_WIDTH; x; x -= count)
+	{
+		count = x > 255 ? 255 : x;
+		glcd_rlepool[i++] = count;
+		glcd_rlepool[i++] = data;
+	}
+}
+
+/*
+ * reverse the order of the pool bytes from start up to end
+ */
+static void glcd_RleReverse(uint16_t start, uint16_t end)
+{
+uint8_t t;
+
+	while(end - start > 1)
+	{
+		t = glcd_rlepool[start];
+		glcd_rlepool[start++] = glcd_rlepool[--end];
+		glcd_rlepool[end] = t;
+	}
+}
+
+/*
+ * store a run length encoded page as raw bytes
+ *
+ * The runs are expanded into the free end of the pool, which is then
+ * rotated in front of the runs (by reversing) and the runs are removed.
+ * When the free end is too small, the page is dropped instead.
+ * returns 0 when the page was dropped
+ */
+static uint8_t glcd_RleRaw(uint8_t page)
+{
+uint16_t off, len, end, i, j;
+uint8_t count;
+
+	off = glcd_rleoff[page];
+	len = glcd_RleLen(page);
+	end = glcd_rleoff[DISPLAY_HEIGHT/8];
+	if(end + DISPLAY_WIDTH > GLCD_RLE_CACHE)
+	{
+		glcd_RleDrop(page);
+		return(0);
+	}
+	j = end;
+	for(i = off; i < off + len; i += 2)
+	{
+		for(count = glcd_rlepool[i]; count; count--)
+			glcd_rlepool[j++] = glcd_rlepool[i+1];
+	}
+	glcd_RleReverse(off, end);
+	glcd_RleReverse(end, end + DISPLAY_WIDTH);
+	glcd_RleReverse(off, end + DISPLAY_WIDTH);
+	for(i = page + 1; i <= DISPLAY_HEIGHT/8; i++)
+		glcd_rleoff[i] += DISPLAY_WIDTH;
+	glcd_RleShift(page, off + DISPLAY_WIDTH + len, -(int16_t) len);
+	return(1);
+}
+
+/*
+ * get the cached byte at column x of a page
+ * returns 0 when the page is not cached
+ */
+static uint8_t glcd_RleGet(uint8_t page, glcdCoord_t x, uint8_t *data)
+{
+uint16_t i = glcd_rleoff[page];
+
+	switch(glcd_RleLen(page))
+	{
+	  case 0:
+		return(0);
+	  case DISPLAY_WIDTH:
+		*data = glcd_rlepool[i + x];
+		return(1);
+	}
+	while(x >= glcd_rlepool[i])
+	{
+		x -= glcd_rlepool[i];
+		i += 2;
+	}
+	*data = glcd_rlepool[i+1];
+	return(1);
+}
+
+/*
+ * change the cached byte at column x of a page
+ *
+ * The run x is in is split in up to 3 runs (before x, x and after x),
+ * unless x can join the run before or after it.
+ */
+static void glcd_RleSet(uint8_t page, glcdCoord_t x, uint8_t data)
+{
+uint16_t off, len, i;
+glcdCoord_t start, last;
+uint8_t count, value, joinprev, joinnext, n;
+uint8_t runs[6];
+
+	off = glcd_rleoff[page];
+	len = glcd_RleLen(page);
+	if(len == 0)
+		return;
+	if(len == DISPLAY_WIDTH)
+	{
+		glcd_rlepool[off + x] = data;
+		return;
+	}
+	for(i = off, start = 0; x >= start + glcd_rlepool[i]; i += 2)
+		start += glcd_rlepool[i];
+	count = glcd_rlepool[i];
+	value = glcd_rlepool[i+1];
+	if(value == data)
+		return;
+	last = start + count - 1;
+
+	joinprev = (x == start) && (i > off) && (glcd_rlepool[i-1] == data) && (glcd_rlepool[i-2] < 255);
+	joinnext = !joinprev && (x == last) && (i + 2 < off + len) &&
+		(glcd_rlepool[i+3] == data) && (glcd_rlepool[i+2] < 255);
+
+	n = 0;
+	if(x > start)
+	{
+		runs[n++] = x - start;
+		runs[n++] = value;
+	}
+	if(!joinprev && !joinnext)
+	{
+		runs[n++] = 1;
+		runs[n++] = data;
+	}
+	if(x < last)
+	{
+		runs[n++] = last - x;
+		runs[n++] = value;
+	}
+
+	if(len - 2 + n >= DISPLAY_WIDTH)
+	{
+		/*
+		 * the runs no longer save anything
+		 */
+		if(glcd_RleRaw(page))
+			glcd_rlepool[glcd_rleoff[page] + x] = data;
+		return;
+	}
+	if(!glcd_RleShift(page, i + 2, n - 2))
+	{
+		glcd_RleDrop(page);
+		return;
+	}
+	if(joinprev)
+		glcd_rlepool[i-2]++;
+	if(joinnext)
+		glcd_rlepool[i+n]++;
+	while(n--)
+		glcd_rlepool[i+n] = runs[n];
+}
+#endif
+
+/*
+ * burst data source modes
+ */
+#define GLCD_BURST_RAM	0	// data comes from a RAM buffer
+#define GLCD_BURST_PGM	1	// data comes from a PROGMEM buffer
+#define GLCD_BURST_FILL	2	// every byte is the single byte pointed to
+
 	
 glcd_Device::glcd_Device(){
   
@@ -120,7 +774,7 @@ glcd_Device::glcd_Device(){
  *
  */
 
-void glcd_Device::SetDot(uint8_t x, uint8_t y, uint8_t color) 
+void glcd_Device::SetDot(glcdCoord_t x, glcdCoord_t y, uint8_t color) 
 {
 	uint8_t data;
 
@@ -159,11 +813,12 @@ void glcd_Device::SetDot(uint8_t x, uint8_t y, uint8_t color)
 // set pixels from upper left edge x,y to lower right edge x1,y1 to the given color
 // the width of the region is x1-x + 1, height is y1-y+1 
 
-void glcd_Device::SetPixels(uint8_t x, uint8_t y,uint8_t x2, uint8_t y2, uint8_t color)
+void glcd_Device::SetPixels(glcdCoord_t x, glcdCoord_t y, glcdCoord_t x2, glcdCoord_t y2, uint8_t color)
 {
-uint8_t mask, pageOffset, h, i, data;
-uint8_t height = y2-y+1;
-uint8_t width = x2-x+1;
+uint8_t mask, pageOffset;
+glcdCoord_t h;
+glcdCoord_t height = y2-y+1;
+glcdCoord_t width = x2-x+1;
 	
 	pageOffset = y%8;
 	y -= pageOffset;
@@ -177,44 +832,26 @@ uint8_t width = x2-x+1;
 	mask <<= pageOffset;
 	
 	this->GotoXY(x, y);
-	for(i=0; i < width; i++) {
-		data = this->ReadData();
-		
-		if(color == BLACK) {
-			data |= mask;
-		} else {
-			data &= ~mask;
-		}
-
-		this->WriteData(data);
+	if(mask == 0xFF) {
+		// first page is a full page
+		this->DoWriteDataBurst(&color, width, GLCD_BURST_FILL, 0);
+	} else {
+		this->UpdateDataBurst(width, ~mask, color & mask);
 	}
 	
 	while(h+8 <= height) {
 		h += 8;
 		y += 8;
 		this->GotoXY(x, y);
-		
-		for(i=0; i <width; i++) {
-			this->WriteData(color);
-		}
+		this->DoWriteDataBurst(&color, width, GLCD_BURST_FILL, 0);
 	}
 	
 	if(h < height) {
 		mask = ~(0xFF << (height-h));
 		this->GotoXY(x, y+8);
-		
-		for(i=0; i < width; i++) {
-			data = this->ReadData();
-		
-			if(color == BLACK) {
-				data |= mask;
-			} else {
-				data &= ~mask;
-			}
-	
-			this->WriteData(data);
-		}
+		this->UpdateDataBurst(width, ~mask, color & mask);
 	}
+	lcdBusEnd();
 }
 
 /**
@@ -228,10 +865,8 @@ uint8_t width = x2-x+1;
  * is the upper left most pixel on the display.
  */
 
-void glcd_Device::GotoXY(uint8_t x, uint8_t y)
+void glcd_Device::GotoXY(glcdCoord_t x, glcdCoord_t y)
 {
-  uint8_t chip, cmd;
-
   if((x == this->Coord.x) && (y == this->Coord.y))
 	return;
 
@@ -243,25 +878,48 @@ void glcd_Device::GotoXY(uint8_t x, uint8_t y)
   this->Coord.x = x;								// save new coordinates
   this->Coord.y = y;
 
-  chip = glcd_DevXYval2Chip(x, y);
+#if !defined(GLCD_READ_CACHE) && !defined(GLCD_PAGE_BAND)
+  /*
+   * When the read cache is used, the glcd hardware is only
+   * positioned when a changed byte is written or
+   * when the write back frame buffer is flushed.
+   * With the page band it is only positioned by NextBand().
+   */
+  this->DoGotoXY(x, y);
+#endif
+}
+
+/*
+ * position the glcd hardware to x,y
+ * (the s/w coordinates are not modified)
+ */
+void glcd_Device::DoGotoXY(glcdCoord_t x, glcdCoord_t y)
+{
+  uint8_t chip, cmd;
+
+  chip = glcd_Chip(x, y);
+
+	y = glcd_Page(y);
+	if(y != this->Coord.chip[chip].page)
+	{
+  		this->Coord.chip[chip].page = y;
+		cmd = LCD_SET_PAGE | this->Coord.chip[chip].page;
+	   	this->WriteCommand(cmd, chip);	
+		glcd_Stat(pagecmds);
+	}
 
-	if(y/8 != this->Coord.chip[chip].page)
-	{
-  		this->Coord.chip[chip].page = y/8;
-		cmd = LCD_SET_PAGE | this->Coord.chip[chip].page;
-	   	this->WriteCommand(cmd, chip);	
-	}
-	
 	/*
-	 * NOTE: For now, the "if" below is intentionally commented out.
-	 * In order for this to work, the code must properly track
-	 * the x coordinate of the chips and not allow it go beyond proper
-	 * boundaries. It isnn't complicated to do, it jsut isn't done that
-	 * way right now.
+	 * With column tracking, the set column command is only sent
+	 * when the chip is not already at the needed column.
 	 */
 
 	x = glcd_DevXval2ChipCol(x);
 
+#ifdef GLCD_RMW_MODE
+	if((x != this->Coord.chip[chip].col) && (glcd_rmwchips & _BV(chip)))
+		this->EndRMW(chip);	// the column can't be set in RMW mode
+#endif
+
 #ifdef GLCD_XCOL_SUPPORT
 	if(x != this->Coord.chip[chip].col)
 #endif
@@ -270,16 +928,22 @@ void glcd_Device::GotoXY(uint8_t x, uint8_t y)
 #ifdef GLCD_XCOL_SUPPORT
 		this->Coord.chip[chip].col = x;
 #endif
+#ifdef GLCD_RMW_MODE
+		glcd_colcmd = 1;
+#endif
 
 #ifdef LCD_SET_ADDLO
 		cmd = LCD_SET_ADDLO | glcd_DevCol2addrlo(x);
 	   	this->WriteCommand(cmd, chip);	
+		glcd_Stat(colcmds);
 
 		cmd = LCD_SET_ADDHI | glcd_DevCol2addrhi(x);
 	   	this->WriteCommand(cmd, chip);	
+		glcd_Stat(colcmds);
 #else
 		cmd = LCD_SET_ADD | x;
 	   	this->WriteCommand(cmd, chip);	
+		glcd_Stat(colcmds);
 #endif
 	}
 }
@@ -313,11 +977,22 @@ void glcd_Device::GotoXY(uint8_t x, uint8_t y)
 int glcd_Device::Init(uint8_t invert)
 {  
 
+#ifdef GLCD_ASYNC_FLUSH
+	glcd_flushdev = 0;	// keep the flush interrupt away from the glcd until init is done
+#endif
+
 	/*
 	 * Now setup the pinmode for all of our control pins.
 	 * The data lines will be configured as necessary when needed.
 	 */
 
+#ifdef GLCD_I2C_BUS
+	lcd_i2cerror = GLCD_ENOERR;
+#endif
+#ifdef lcdBusInit
+	lcdBusInit();	// bus hardware that needs setting up (shift register bus)
+#endif
+
 	lcdPinMode(glcdDI,OUTPUT);	
 	lcdPinMode(glcdRW,OUTPUT);	
 
@@ -363,14 +1038,85 @@ int glcd_Device::Init(uint8_t invert)
 #endif
 
 
-	lcdfastWrite(glcdDI, LOW);
-	lcdfastWrite(glcdRW, LOW);
+	glcd_busdir = glcd_busctl = 0x55;	// bus state is unknown
+	glcd_BusDIRW(LOW, LOW);
+	lcdBusEnd();
+
+	glcd_error = GLCD_ENOERR;
+#ifdef GLCD_I2C_BUS
+	if(lcd_i2cerror)
+		return(GLCD_EI2C);	// the expander is not there or the bus is stuck
+#endif
+#if GLCD_BUSYMODE == GLCD_BUSY_ADAPTIVE
+	glcd_busyseen = 0;
+	glcd_busyskip = 0;	// poll every access until the chips have been measured
+#endif
+
+#ifdef GLCD_RMW_MODE
+	glcd_rmwchips = 0;
+	glcd_colcmd = 1;
+#endif
 
 	this->Coord.x = -1;  // invalidate the s/w coordinates so the first GotoXY() works
 	this->Coord.y = -1;  // invalidate the s/w coordinates so the first GotoXY() works
 	
 	this->Inverted = invert;
 
+#if glcd_PANEL_COUNT > 1
+	glcd_panel = 0;
+	glcd_panelchip = 0;
+	for(uint8_t panel = 0; panel < glcd_PANEL_COUNT; panel++)
+	{
+		glcd_panels[panel].x = -1;
+		glcd_panels[panel].y = -1;
+		glcd_panels[panel].inverted = invert;
+#ifdef GLCD_HW_SCROLL
+		glcd_panels[panel].startpage = 0;
+#endif
+	}
+#endif
+
+#ifdef GLCD_PAGE_CACHE
+	glcd_PcInvalidate();
+#endif
+#ifdef GLCD_RLE_CACHE
+	glcd_RleInvalidate();	// the clear below caches every page
+#endif
+
+#ifdef GLCD_READ_CACHE
+	/*
+	 * Fill the read cache with the complement of the clear value
+	 * so the clear below does not skip any bytes and rewrites the entire display
+	 */
+	for(uint8_t page = 0; page < DISPLAY_HEIGHT/8; page++)
+	{
+		for(glcdCoord_t x = 0; x < DISPLAY_WIDTH; x++)
+			glcd_rdcache[page][x] = this->Inverted ? 0x00 : 0xff;
+#ifdef GLCD_WRITEBACK_CACHE
+		glcd_dirtyx1[page] = DISPLAY_WIDTH;
+		glcd_dirtyx2[page] = 0;
+#endif
+	}
+#ifdef GLCD_DOUBLE_BUFFER
+	/*
+	 * glcd memory contents are unknown, assume the worst like the read cache
+	 */
+	for(uint8_t page = 0; page < DISPLAY_HEIGHT/8; page++)
+	{
+		for(glcdCoord_t x = 0; x < DISPLAY_WIDTH; x++)
+			glcd_frontbuf[page][x] = this->Inverted ? 0x00 : 0xff;
+	}
+#endif
+#ifdef GLCD_WRITEBACK_CACHE
+	glcd_flpage = 0;
+	glcd_flx = 1;	// no span being sent
+	glcd_flx2 = 0;
+#else
+	glcd_hwx = (glcdCoord_t) -1;
+	glcd_hwpage = 0xff;
+#endif
+#endif
+
 #ifdef glcdRES
 	/*
 	 * Reset the glcd module if there is a reset pin defined
@@ -396,13 +1142,25 @@ int glcd_Device::Init(uint8_t invert)
 #endif
 
 
+#ifdef GLCD_HW_SCROLL
 	/*
-	 * Each chip on the module must be initliazed
+	 * the chip initialization sets the display start line to 0
+	 */
+	glcd_startpage = 0;
+#ifdef GLCD_WRITEBACK_CACHE
+	glcd_hwstartpage = 0;
+#endif
+#endif
+
+	/*
+	 * Each chip on the module (on every panel) must be initliazed
 	 */
 
-	for(uint8_t chip=0; chip < glcd_CHIP_COUNT; chip++)
+	for(uint8_t chip=0; chip < glcd_TOTAL_CHIPS; chip++)
 	{
+#if !defined(GLCD_NOINIT_CHECKS) || defined(glcd_DeviceInit)
 	uint8_t status;
+#endif
 
 #ifndef GLCD_NOINIT_CHECKS
 		/*
@@ -449,10 +1207,72 @@ int glcd_Device::Init(uint8_t invert)
 	 * as needed.
 	 * So clearing an areas to WHITE when the mode is INVERTED will set the area to BLACK
 	 * as is required.
+	 *
+	 * With several panels each one is cleared (and measured) in turn, ending with panel 0.
 	 */
 
+#if glcd_PANEL_COUNT > 1
+	for(uint8_t panel = glcd_PANEL_COUNT; panel--; )
+	{
+	this->SelectPanel(panel);
+#endif
+#ifdef GLCD_PAGE_BAND
+	this->FirstBand();		// a picture of nothing but empty bands
+	while(this->NextBand())
+		;
+#else
 	this->SetPixels(0,0, DISPLAY_WIDTH-1,DISPLAY_HEIGHT-1, WHITE);
+	this->Flush();
+#endif
+	this->GotoXY(0,0);
+	lcdBusEnd();
+
+	/*
+	 * The clear polled the chips on every command and data write,
+	 * a glcd that never came ready has failed.
+	 */
+	if(this->GetError())
+		return(GLCD_EBUSY);
+
+#if GLCD_BUSYMODE == GLCD_BUSY_ADAPTIVE
+	/*
+	 * The clear accessed each chip back to back with commands and data writes
+	 * as fast as the code can go, also do a data write followed by reads
+	 * (the dummy read and the real read) on each chip.
+	 * A chip that was never found busy by any of it is always ready by the
+	 * next access so it doesn't need to be polled.
+	 */
+	for(glcdCoord_t y = 0; y < DISPLAY_HEIGHT; y += CHIP_HEIGHT)
+	{
+		for(glcdCoord_t x = 0; x < DISPLAY_WIDTH; x += CHIP_WIDTH)
+		{
+			this->GotoXY(x, y);
+			this->DoWriteData(this->Inverted ? 0xff : 0x00, glcd_Chip(x, y));	// what the clear wrote
+			this->GotoXY(x, y);
+			this->DoReadData();
+			this->DoReadData();
+		}
+	}
+	this->Coord.x = -1;
 	this->GotoXY(0,0);
+	lcdBusEnd();
+#endif
+#if glcd_PANEL_COUNT > 1
+	}
+#endif
+#if GLCD_BUSYMODE == GLCD_BUSY_ADAPTIVE
+	glcd_busyskip = ~glcd_busyseen;
+#endif
+
+#ifdef GLCD_ASYNC_FLUSH
+	/*
+	 * from here on the frame buffer is sent to the glcd by the flush interrupt
+	 */
+	glcd_flushdev = this;
+#ifdef lcdAsyncTimerInit
+	lcdAsyncTimerInit();
+#endif
+#endif
 
 	return(GLCD_ENOERR);
 }
@@ -461,6 +1281,18 @@ int glcd_Device::Init(uint8_t invert)
 __inline__ void glcd_Device::SelectChip(uint8_t chip)
 {  
 
+#ifdef glcd_CHIP7
+	if(chip == 7) lcdChipSelect(glcd_CHIP7); else
+#endif
+#ifdef glcd_CHIP6
+	if(chip == 6) lcdChipSelect(glcd_CHIP6); else
+#endif
+#ifdef glcd_CHIP5
+	if(chip == 5) lcdChipSelect(glcd_CHIP5); else
+#endif
+#ifdef glcd_CHIP4
+	if(chip == 4) lcdChipSelect(glcd_CHIP4); else
+#endif
 #ifdef glcd_CHIP3
 	if(chip == 3) lcdChipSelect(glcd_CHIP3); else
 #endif
@@ -480,10 +1312,9 @@ uint8_t glcd_Device::GetStatus(uint8_t chip)
 uint8_t status;
 
 	glcd_DevSelectChip(chip);
-	lcdDataDir(0x00);			// input mode
+	glcd_BusDataDir(0x00);		// input mode
 	lcdDataOut(0xff);			// turn on pullups
-	lcdfastWrite(glcdDI, LOW);	
-	lcdfastWrite(glcdRW, HIGH);	
+	glcd_BusDIRW(LOW, HIGH);	// D/I = 0, R/W = 1
 //	lcdDelayNanoseconds(GLCD_tAS);
 	glcd_DevENstrobeHi(chip);
 	lcdDelayNanoseconds(GLCD_tDDR);
@@ -491,26 +1322,101 @@ uint8_t status;
 	status = lcdDataIn();	// Read status bits
 
 	glcd_DevENstrobeLo(chip);
+	glcd_Trace(GLCD_TRACE_STATUS, chip, status);
 	return(status);
 }
 
 
-// wait until LCD busy bit goes to zero
-void glcd_Device::WaitReady( uint8_t chip)
+/*
+ * wait until LCD busy bit goes to zero
+ *
+ * Gives up after GLCD_BUSY_TIMEOUT polls and returns GLCD_EBUSY,
+ * which is also kept for GetError(), so a dead or disconnected glcd
+ * slows the drawing down rather than hanging the sketch.
+ */
+uint8_t glcd_Device::WaitReady( uint8_t chip)
 {
+uint16_t polls = 0;
+
 	glcd_DevSelectChip(chip);
-	lcdDataDir(0x00);
-	lcdfastWrite(glcdDI, LOW);	
-	lcdfastWrite(glcdRW, HIGH);	
+
+#if GLCD_BUSYMODE == GLCD_BUSY_ADAPTIVE
+	/*
+	 * Chips that were never busy when Init() accessed them back to back
+	 * are only polled once in a while.
+	 * A poll samples the status GLCD_tDDR into its strobe, so that much is
+	 * waited instead to not get to the chip sooner than the polls did.
+	 */
+	if((glcd_busyskip & _BV(chip)) && (++glcd_busychecks & (GLCD_BUSY_CHECK-1)))
+	{
+		lcdDelayNanoseconds(GLCD_tDDR);
+		return(GLCD_ENOERR);
+	}
+#endif
+
+#if GLCD_BUSYMODE == GLCD_BUSY_TIMED || GLCD_BUSYMODE == GLCD_BUSY_HYBRID
+#ifdef lcdTimerTicks
+	/*
+	 * Nothing to wait for if the chip has been idle longer than its busy time.
+	 */
+	uint8_t elapsed = lcdTimerTicks() - glcd_busyts[chip];
+
+	if(glcd_busycmd & _BV(chip))
+	{
+		if(elapsed > GLCD_tBUSY_CMD_TICKS)
+			return(GLCD_ENOERR);
+	}
+	else if(elapsed > GLCD_tBUSY_DATA_TICKS)
+		return(GLCD_ENOERR);
+#endif
+#if GLCD_BUSYMODE == GLCD_BUSY_TIMED
+	/*
+	 * The chip may still be busy, wait out the full busy time
+	 */
+	if(glcd_busycmd & _BV(chip))
+		lcdDelayNanoseconds(GLCD_tBUSY_CMD);
+	else
+		lcdDelayNanoseconds(GLCD_tBUSY_DATA);
+	return(GLCD_ENOERR);
+#endif
+#endif
+
+	glcd_BusDataDir(0x00);		// input mode
+	glcd_BusDIRW(LOW, HIGH);	// D/I = 0, R/W = 1
 //	lcdDelayNanoseconds(GLCD_tAS);
 	glcd_DevENstrobeHi(chip);
 	lcdDelayNanoseconds(GLCD_tDDR);
 
 	while(lcdRdBusystatus())
 	{
-       ;
+		if(++polls >= GLCD_BUSY_TIMEOUT)
+		{
+			glcd_DevENstrobeLo(chip);
+			if(!glcd_error)
+				glcd_error = GLCD_EBUSY;
+#if GLCD_BUSYMODE == GLCD_BUSY_ADAPTIVE
+			glcd_busyseen |= _BV(chip);
+			glcd_busyskip &= ~_BV(chip);
+#endif
+#ifdef GLCD_STATS
+			glcd_stats.busytimeouts++;
+			glcd_StatBusy(chip, polls);
+#endif
+			return(GLCD_EBUSY);
+		}
 	}
 	glcd_DevENstrobeLo(chip);
+#if GLCD_BUSYMODE == GLCD_BUSY_ADAPTIVE
+	if(polls)
+	{
+		glcd_busyseen |= _BV(chip);
+		glcd_busyskip &= ~_BV(chip);	// it is slower than Init() found, poll it from now on
+	}
+#endif
+#ifdef GLCD_STATS
+	glcd_StatBusy(chip, polls);
+#endif
+	return(GLCD_ENOERR);
 }
 
 /*
@@ -520,11 +1426,11 @@ uint8_t glcd_Device::DoReadData()
 {
 	uint8_t data, chip;
 
-	chip = glcd_DevXYval2Chip(this->Coord.x, this->Coord.y);
+	chip = glcd_Chip(this->Coord.x, this->Coord.y);
 
 	this->WaitReady(chip);
-	lcdfastWrite(glcdDI, HIGH);		// D/I = 1
-	lcdfastWrite(glcdRW, HIGH);		// R/W = 1
+	glcd_BusDataDir(0x00);			// data port is input
+	glcd_BusDIRW(HIGH, HIGH);		// D/I = 1, R/W = 1
 	
 	lcdDelayNanoseconds(GLCD_tAS);
 	glcd_DevENstrobeHi(chip);
@@ -532,84 +1438,1065 @@ uint8_t glcd_Device::DoReadData()
 
 	data = lcdDataIn();	// Read the data bits from the LCD
 
-	glcd_DevENstrobeLo(chip);
-#ifdef GLCD_XCOL_SUPPORT
-	this->Coord.chip[chip].col++;
+	glcd_DevENstrobeLo(chip);
+	glcd_BusyMark(chip, 0);
+	glcd_Trace(GLCD_TRACE_READ, chip, data);
+	glcd_Stat(reads);
+	glcd_StatChip(chip);
+#ifdef GLCD_XCOL_SUPPORT
+#ifdef GLCD_RMW_MODE
+	if(!(glcd_rmwchips & _BV(chip)))	// reads don't move the column in RMW mode
+#endif
+	this->Coord.chip[chip].col = glcd_DevColNext(this->Coord.chip[chip].col);
+#endif
+	return data;
+}
+/**
+ * read a data byte from display device memory
+ *
+ * @return the data byte at the current x,y position
+ *
+ * @note the current x,y location is not modified by the routine.
+ *	This allows a read/modify/write operation.
+ *	Code can call ReadData() modify the data then
+ *  call WriteData() and update the same location.
+ *
+ * @see WriteData()
+ */
+
+#ifdef GLCD_READ_CACHE
+uint8_t glcd_Device::ReadData()
+{
+glcdCoord_t x;
+uint8_t data;
+	x = this->Coord.x;
+	if(x >= DISPLAY_WIDTH)
+	{
+		return(0);
+	}
+	data = glcd_rdcache[glcd_Page(this->Coord.y)][x];
+
+	if(this->Inverted)
+	{
+		data = ~data;
+	}
+	return(data);
+}
+#elif defined(GLCD_PAGE_BAND)
+uint8_t glcd_Device::ReadData()
+{
+uint8_t row, data;
+
+	row = glcd_BandRow(this->Coord.y);
+	if((this->Coord.x >= DISPLAY_WIDTH) || (row >= GLCD_PAGE_BAND))
+	{
+		return(0);	// outside the band is empty
+	}
+	data = glcd_band[row][this->Coord.x];
+
+	if(this->Inverted)
+	{
+		data = ~data;
+	}
+	return(data);
+}
+#else
+
+inline uint8_t glcd_Device::ReadData()
+{  
+glcdCoord_t x;
+uint8_t data;
+
+
+	x = this->Coord.x;
+	if(x >= DISPLAY_WIDTH)
+	{
+		return(0);
+	}
+
+#ifdef GLCD_PAGE_CACHE
+	/*
+	 * A cached column needs no bus access at all,
+	 * the glcd hardware stays at x for the write that follows.
+	 */
+	uint8_t e = glcd_PcEntry(glcd_Page(this->Coord.y), 1);
+
+	if(glcd_PcValid(e, x))
+	{
+		glcd_Stat(cachehits);
+		data = glcd_pcdata[e][x];
+		if(this->Inverted)
+			data = ~data;
+		return(data);
+	}
+	glcd_Stat(cachemisses);
+#endif
+#ifdef GLCD_RLE_CACHE
+	if(glcd_RleGet(glcd_Page(this->Coord.y), x, &data))
+	{
+		glcd_Stat(cachehits);
+		if(this->Inverted)
+			data = ~data;
+		return(data);
+	}
+	glcd_Stat(cachemisses);
+#endif
+
+#ifdef GLCD_RMW_MODE
+	uint8_t chip = glcd_Chip(x, this->Coord.y);
+
+	if(!glcd_colcmd && !(glcd_rmwchips & _BV(chip)))
+	{
+		/*
+		 * The previous write left the column here,
+		 * so this starts a column sequential read/modify/write run.
+		 */
+		this->WriteCommand(LCD_RMW, chip);
+		glcd_rmwchips |= _BV(chip);
+		glcd_rmwcol[chip] = this->Coord.chip[chip].col;
+	}
+
+	if(glcd_rmwchips & _BV(chip))
+	{
+		/*
+		 * The column does not move on reads so it is still
+		 * at x for the write that follows.
+		 */
+		this->DoReadData();				// dummy read
+		glcd_Stat(dummyreads);
+		data = this->DoReadData();		// "real" read
+#ifdef GLCD_PAGE_CACHE
+		glcd_PcSet(e, x, data);
+#endif
+		if(this->Inverted)
+			data = ~data;
+		return(data);
+	}
+#endif
+
+	this->DoReadData();				// dummy read
+	glcd_Stat(dummyreads);
+
+	data = this->DoReadData();			// "real" read
+#ifdef GLCD_PAGE_CACHE
+	glcd_PcSet(e, x, data);
+#endif
+
+	if(this->Inverted)
+	{
+		data = ~data;
+	}
+
+	this->Coord.x = -1;	// force a set column on GotoXY
+
+	this->GotoXY(x, this->Coord.y);	
+	return(data);
+}
+#endif
+
+void glcd_Device::WriteCommand(uint8_t cmd, uint8_t chip)
+{
+	this->WaitReady(chip);
+	glcd_BusDIRW(LOW, LOW);						// D/I = 0, R/W = 0
+	glcd_BusDataDir(0xFF);						// data port is output
+
+	lcdDataOut(cmd);		/* This could be done before or after raising E */
+	lcdDelayNanoseconds(GLCD_tAS);
+	glcd_DevENstrobeHi(chip);
+	lcdDelayNanoseconds(GLCD_tWH);
+	glcd_DevENstrobeLo(chip);
+	glcd_BusyMark(chip, 1);
+	glcd_Trace(GLCD_TRACE_CMD, chip, cmd);
+	glcd_Stat(cmds);
+	glcd_StatChip(chip);
+}
+
+/*
+ * write a single data byte to chip at its current hardware location
+ */
+void glcd_Device::DoWriteData(uint8_t data, uint8_t chip)
+{
+	this->WaitReady(chip);
+	glcd_BusDIRW(HIGH, LOW);				// D/I = 1, R/W = 0
+	glcd_BusDataDir(0xFF);					// data port is output
+
+#ifdef GLCD_SERIAL_BUS
+	lcdDataOut(data);						// write data along with the control lines
+#endif
+	lcdDelayNanoseconds(GLCD_tAS);
+	glcd_DevENstrobeHi(chip);
+
+#ifndef GLCD_SERIAL_BUS
+	lcdDataOut(data);						// write data
+#endif
+
+	lcdDelayNanoseconds(GLCD_tWH);
+
+	glcd_DevENstrobeLo(chip);
+	glcd_BusyMark(chip, 0);
+	glcd_Trace(GLCD_TRACE_WRITE, chip, data);
+	glcd_StatWrite();
+	glcd_StatChip(chip);
+#ifdef GLCD_XCOL_SUPPORT
+	this->Coord.chip[chip].col = glcd_DevColNext(this->Coord.chip[chip].col);
+#endif
+#ifdef GLCD_RMW_MODE
+	glcd_colcmd = 0;
+#endif
+#ifdef GLCD_WRITE_COUNTS
+	this->WritesSent++;
+#endif
+}
+
+#ifdef GLCD_CHIP_BROADCAST
+/*
+ * write a single command (di LOW) or data (di HIGH) byte to all chips at once
+ *
+ * Every chip must be ready, so each one is waited on individually
+ * before they are all selected together for the write.
+ */
+void glcd_Device::DoWriteAll(uint8_t data, uint8_t di)
+{
+	uint8_t chip;
+
+	for(chip = 0; chip < glcd_CHIP_COUNT; chip++)
+	{
+#if GLCD_BUSYMODE == GLCD_BUSY_TIMED
+		/*
+		 * The timed wait for chip 0 also covers the chips that went busy
+		 * doing the same kind of instruction in the same timer tick,
+		 * which is always the case after a previous write to all chips.
+		 */
+		if(chip && !(((glcd_busycmd >> chip) ^ glcd_busycmd) & 1)
+#ifdef lcdTimerTicks
+			&& (glcd_busyts[chip] == glcd_busyts[0])
+#endif
+			)
+			continue;
+#endif
+		this->WaitReady(chip);
+	}
+
+	lcdChipSelect(glcd_CHIPALL);
+	glcd_BusDIRW(di, LOW);					// D/I = di, R/W = 0
+	glcd_BusDataDir(0xFF);					// data port is output
+
+	lcdDataOut(data);
+	lcdDelayNanoseconds(GLCD_tAS);
+	glcd_DevENstrobeHi(0);
+	lcdDelayNanoseconds(GLCD_tWH);
+	glcd_DevENstrobeLo(0);
+
+	for(chip = 0; chip < glcd_CHIP_COUNT; chip++)
+		glcd_BusyMark(chip, di == LOW);
+	glcd_Trace(di == LOW ? GLCD_TRACE_CMD : GLCD_TRACE_WRITE, GLCD_TRACE_ALLCHIPS, data);
+#ifdef GLCD_STATS
+	if(di == LOW)
+		glcd_Stat(cmds);
+	else
+		glcd_StatWrite();
+	glcd_StatChip(glcd_TOTAL_CHIPS);
+#endif
+#ifdef GLCD_WRITE_COUNTS
+	if(di != LOW)
+		this->WritesSent++;
+#endif
+}
+
+/*
+ * write the same page of display memory to all chips at once
+ *
+ * buf points to CHIP_WIDTH bytes of raw display memory data (GLCD_BURST_RAM)
+ * or to a single byte to fill the page with (GLCD_BURST_FILL).
+ * The s/w x,y location is not modified.
+ */
+void glcd_Device::DoWritePageAll(uint8_t page, const uint8_t *buf, uint8_t mode)
+{
+	uint8_t chip, x, setpage = 0, setcol = 0;
+
+	for(chip = 0; chip < glcd_CHIP_COUNT; chip++)
+	{
+		if(this->Coord.chip[chip].page != page)
+			setpage = 1;
+		if(this->Coord.chip[chip].col != 0)
+			setcol = 1;
+	}
+
+	if(setpage)
+	{
+		this->DoWriteAll(LCD_SET_PAGE | page, LOW);
+		glcd_Stat(pagecmds);
+	}
+	if(setcol)
+	{
+		this->DoWriteAll(LCD_SET_ADD | 0, LOW);	// every chip starts at column 0 (glcd_DevChipAll)
+		glcd_Stat(colcmds);
+	}
+
+	for(x = 0; x < CHIP_WIDTH; x++)
+		this->DoWriteAll(mode == GLCD_BURST_FILL ? *buf : buf[x], HIGH);
+
+	for(chip = 0; chip < glcd_CHIP_COUNT; chip++)
+	{
+		this->Coord.chip[chip].page = page;
+#ifdef glcd_DevColWrap
+		this->Coord.chip[chip].col = CHIP_WIDTH % glcd_DevColWrap;
+#else
+		this->Coord.chip[chip].col = CHIP_WIDTH;
+#endif
+	}
+}
+#endif
+
+#ifdef GLCD_RMW_MODE
+/*
+ * take a chip out of read-modify-write mode
+ * (which also returns its column to where it was when the mode started)
+ */
+void glcd_Device::EndRMW(uint8_t chip)
+{
+	this->WriteCommand(LCD_RMW_END, chip);
+	glcd_rmwchips &= ~_BV(chip);
+	this->Coord.chip[chip].col = glcd_rmwcol[chip];
+}
+#endif
+
+/*
+ * store a display memory byte at the current s/w x,y location
+ *
+ * The data is the raw display memory data (already inverted if necessary).
+ * The s/w x,y location is not modified.
+ * With the read cache, a byte that matches what the cache says is already
+ * in display memory is not written at all, so neither is any positioning
+ * needed to get to it.
+ * With the write back cache, the data only goes to the frame buffer
+ * and the column is marked dirty so the next Flush() will send it to the glcd.
+ * With the page band, it only goes to the band and only if it is in the band.
+ * With the page cache or the run length encoded cache,
+ * it is written and also kept in the cache.
+ */
+void glcd_Device::StoreData(uint8_t data, uint8_t chip)
+{
+#ifdef GLCD_PAGE_BAND
+uint8_t row = glcd_BandRow(this->Coord.y);
+
+	if(row < GLCD_PAGE_BAND)
+		glcd_band[row][this->Coord.x] = data;
+#else
+#ifdef GLCD_READ_CACHE
+uint8_t page = glcd_Page(this->Coord.y);
+
+	if(glcd_rdcache[page][this->Coord.x] == data)
+	{
+#ifdef GLCD_WRITE_COUNTS
+		this->WritesSkipped++;
+#endif
+		return;	// display memory already has this data
+	}
+	glcd_rdcache[page][this->Coord.x] = data; // save to read cache
+#endif
+
+#ifdef GLCD_WRITEBACK_CACHE
+#ifdef GLCD_ASYNC_FLUSH
+	/*
+	 * The flush interrupt must not take the span between
+	 * the two updates or it could miss this column.
+	 */
+	uint8_t sreg;
+
+	lcdIntSave(sreg);
+#endif
+	if(this->Coord.x < glcd_dirtyx1[page])
+		glcd_dirtyx1[page] = this->Coord.x;
+	if(this->Coord.x > glcd_dirtyx2[page])
+		glcd_dirtyx2[page] = this->Coord.x;
+#ifdef GLCD_ASYNC_FLUSH
+	lcdIntRestore(sreg);
+#endif
+#else
+#ifdef GLCD_READ_CACHE
+	if((this->Coord.x != glcd_hwx) || (page != glcd_hwpage))
+	{
+		this->DoGotoXY(this->Coord.x, this->Coord.y);
+		glcd_hwpage = page;
+	}
+#endif
+#ifdef GLCD_PAGE_CACHE
+	uint8_t e = glcd_PcEntry(glcd_Page(this->Coord.y), 1);
+	glcd_PcSet(e, this->Coord.x, data);
+#endif
+#ifdef GLCD_RLE_CACHE
+	glcd_RleSet(glcd_Page(this->Coord.y), this->Coord.x, data);
+#endif
+	this->DoWriteData(data, chip);
+#ifdef GLCD_READ_CACHE
+	/*
+	 * the hardware column advanced, but it is only usable
+	 * for the next write if it is still within the same chip.
+	 */
+	glcd_hwx = this->Coord.x + 1;
+	if(glcd_hwx >= glcd_DevChipEndX(this->Coord.x))
+		glcd_hwx = (glcdCoord_t) -1;
+#endif
+#endif
+#endif
+}
+
+/**
+ * Flush the frame buffer to the display device
+ *
+ * When the library is configured to use the write back cache (@b GLCD_WRITEBACK_CACHE),
+ * all drawing is done into the frame buffer and the display is only updated
+ * when Flush() is called.
+ * Only the columns of each LCD page that were written since the previous Flush()
+ * are sent to the display.
+ * With double buffering (@b GLCD_DOUBLE_BUFFER), only those that also differ
+ * from what the display shows are sent.
+ *
+ * When the asynchronous flush is configured (@b GLCD_ASYNC_FLUSH), a timer
+ * interrupt is already sending the frame buffer to the display in the background
+ * and Flush() simply waits for it to be completely sent.
+ *
+ * When the write back cache is not configured, the display is always up to date
+ * and Flush() does nothing.
+ *
+ * @see FlushStep()
+ * @see FlushPending()
+ */
+
+void glcd_Device::Flush(void)
+{
+	while(this->FlushStep())
+		;
+}
+
+/**
+ * Send part of the frame buffer to the display device
+ *
+ * @returns non zero if there is more to send, 0 when the display is up to date
+ *
+ * Sends at most @b GLCD_FLUSH_CHUNK of the columns waiting in the frame buffer
+ * so the time it takes is bounded.
+ * This is what the timer interrupt of the asynchronous flush calls,
+ * but it can also be called from a sketch or from its own timer interrupt
+ * to update the display a little at a time.
+ *
+ * Drawing can continue while columns are being sent,
+ * anything drawn is simply sent again.
+ *
+ * @see Flush()
+ */
+
+uint8_t glcd_Device::FlushStep(void)
+{
+#ifdef GLCD_WRITEBACK_CACHE
+uint8_t n, chip;
+glcdCoord_t y;
+#ifdef GLCD_ASYNC_FLUSH
+uint8_t sreg;
+
+	lcdIntSave(sreg);	// keep the flush interrupt out while sending
+#endif
+
+	for(n = GLCD_FLUSH_CHUNK; n; n--)
+	{
+		if(glcd_flx > glcd_flx2)
+		{
+			/*
+			 * Done with the last span, take the dirty span of the next dirty page.
+			 */
+#ifdef GLCD_HW_SCROLL
+			if(glcd_hwstartpage != glcd_startpage)
+				this->DoDispStart();
+#endif
+			for(y = 0; y < DISPLAY_HEIGHT/8; y++)
+			{
+				if(++glcd_flpage >= DISPLAY_HEIGHT/8)
+					glcd_flpage = 0;
+				if(glcd_dirtyx1[glcd_flpage] <= glcd_dirtyx2[glcd_flpage])
+					break;
+			}
+			if(y == DISPLAY_HEIGHT/8)
+			{
+				lcdBusEnd();
+#ifdef GLCD_ASYNC_FLUSH
+				lcdIntRestore(sreg);
+#endif
+				return(0);	// every page is clean
+			}
+			glcd_flx = glcd_dirtyx1[glcd_flpage];
+			glcd_flx2 = glcd_dirtyx2[glcd_flpage];
+			glcd_dirtyx1[glcd_flpage] = DISPLAY_WIDTH;
+			glcd_dirtyx2[glcd_flpage] = 0;
+			glcd_flchip = glcd_CHIP_COUNT;	// an impossible chip to force the first positioning
+
+#if defined(GLCD_CHIP_BROADCAST) && !defined(GLCD_ASYNC_FLUSH)
+			/*
+			 * A fully dirty page that is the same on every chip
+			 * is written to all the chips at once.
+			 * (not done by the flush interrupt as it is a lot to send at once)
+			 */
+			if((glcd_flx == 0) && (glcd_flx2 == DISPLAY_WIDTH-1))
+			{
+				glcdCoord_t x;
+
+				for(x = CHIP_WIDTH; x < DISPLAY_WIDTH; x++)
+				{
+					if(glcd_rdcache[glcd_flpage][x] != glcd_rdcache[glcd_flpage][x - CHIP_WIDTH])
+						break;
+				}
+#ifdef GLCD_DOUBLE_BUFFER
+				/*
+				 * only worth it when more than a chip's worth of columns changed
+				 */
+				if(x == DISPLAY_WIDTH)
+				{
+					glcdCoord_t changed = 0;
+
+					for(x = 0; x < DISPLAY_WIDTH; x++)
+					{
+						if(glcd_rdcache[glcd_flpage][x] != glcd_frontbuf[glcd_flpage][x])
+							changed++;
+					}
+					if(changed <= CHIP_WIDTH)
+						x = 0;
+				}
+#endif
+				if(x == DISPLAY_WIDTH)
+				{
+					this->DoWritePageAll(glcd_flpage, glcd_rdcache[glcd_flpage], GLCD_BURST_RAM);
+#ifdef GLCD_DOUBLE_BUFFER
+					for(x = 0; x < DISPLAY_WIDTH; x++)
+						glcd_frontbuf[glcd_flpage][x] = glcd_rdcache[glcd_flpage][x];
+#endif
+					glcd_flx = 1;
+					glcd_flx2 = 0;
+					continue;
+				}
+			}
+#endif
+		}
+
+		/*
+		 * send the next dirty column of the span to the glcd
+		 * The columns auto increment so the glcd hardware only
+		 * needs to be positioned at the start and when crossing chips.
+		 * Nothing else talks to the glcd in between so the position holds
+		 * from one call to the next.
+		 */
+#ifdef GLCD_DOUBLE_BUFFER
+		if(glcd_rdcache[glcd_flpage][glcd_flx] == glcd_frontbuf[glcd_flpage][glcd_flx])
+		{
+			/*
+			 * The glcd already has it (drawn over and then back again).
+			 * The glcd column doesn't advance, so positioning is needed
+			 * for the next column that is sent.
+			 */
+#ifdef GLCD_WRITE_COUNTS
+			this->WritesSkipped++;
+#endif
+			glcd_flchip = glcd_CHIP_COUNT;
+		}
+		else
+#endif
+		{
+			y = glcd_PageY(glcd_flpage);
+			chip = glcd_Chip(glcd_flx, y);
+			if(chip != glcd_flchip)
+			{
+				glcd_flchip = chip;
+				this->DoGotoXY(glcd_flx, y);
+			}
+			this->DoWriteData(glcd_rdcache[glcd_flpage][glcd_flx], chip);
+#ifdef GLCD_DOUBLE_BUFFER
+			glcd_frontbuf[glcd_flpage][glcd_flx] = glcd_rdcache[glcd_flpage][glcd_flx];
+#endif
+		}
+
+		if(glcd_flx == glcd_flx2)
+		{
+			glcd_flx = 1;	// span is done
+			glcd_flx2 = 0;
+		}
+		else
+			glcd_flx++;
+	}
+	lcdBusEnd();
+#ifdef GLCD_ASYNC_FLUSH
+	lcdIntRestore(sreg);
+#endif
+	return(1);
+#else
+	return(0);
+#endif
+}
+
+/*
+ * frame pacing for Present()
+ */
+static uint16_t glcd_frameperiod;	// milliseconds between frames (0 is no limit)
+static unsigned long glcd_framedue;	// millis() when the next frame may be shown
+
+/**
+ * Show a completed frame
+ *
+ * Waits until the frame rate set by SetFrameRate() allows the next frame
+ * and then sends the frame to the display device.
+ *
+ * When the library is configured for double buffering (@b GLCD_DOUBLE_BUFFER)
+ * the display is only changed by Present() and only the columns
+ * that differ from what the display already shows are sent.
+ * So a sketch can erase and redraw its objects for every frame
+ * without the display ever showing the erased objects.
+ * The write back cache (@b GLCD_WRITEBACK_CACHE) does the same but also
+ * sends columns that were drawn over and then restored.
+ *
+ * Without a frame buffer, drawing goes straight to the display
+ * so Present() only paces the frames.
+ *
+ * @see SetFrameRate()
+ * @see Flush()
+ */
+
+void glcd_Device::Present(void)
+{
+	if(glcd_frameperiod)
+	{
+		while((long)(millis() - glcd_framedue) < 0)
+			;
+		/*
+		 * Stay on the frame schedule unless a whole frame late
+		 * so the frame rate holds steady.
+		 */
+		glcd_framedue += glcd_frameperiod;
+		if((long)(millis() - glcd_framedue) >= 0)
+			glcd_framedue = millis() + glcd_frameperiod;
+	}
+	this->Flush();
+}
+
+/**
+ * Limit the rate of Present()
+ *
+ * @param fps maximum frames per second, 0 for no limit
+ *
+ * Keeps animations at a steady speed and leaves the rest of the
+ * time to the sketch rather than the display bus.
+ *
+ * @see Present()
+ */
+
+void glcd_Device::SetFrameRate(uint8_t fps)
+{
+	glcd_frameperiod = fps ? 1000 / fps : 0;
+	glcd_framedue = millis();
+}
+
+/**
+ * Get the amount of the frame buffer waiting to be sent to the display device
+ *
+ * @returns the number of columns (bytes) not yet sent.
+ *
+ * Allows a sketch to follow the progress of the asynchronous flush.
+ * Columns being drawn while the flush is sending may be counted twice.
+ *
+ * @see Flush()
+ */
+
+uint16_t glcd_Device::FlushPending(void)
+{
+uint16_t n = 0;
+
+#ifdef GLCD_WRITEBACK_CACHE
+#ifdef GLCD_ASYNC_FLUSH
+uint8_t sreg;
+
+	lcdIntSave(sreg);
+#endif
+	if(glcd_flx <= glcd_flx2)
+		n = glcd_flx2 - glcd_flx + 1;
+	for(uint8_t page = 0; page < DISPLAY_HEIGHT/8; page++)
+	{
+		if(glcd_dirtyx1[page] <= glcd_dirtyx2[page])
+			n += glcd_dirtyx2[page] - glcd_dirtyx1[page] + 1;
+	}
+#ifdef GLCD_ASYNC_FLUSH
+	lcdIntRestore(sreg);
+#endif
+#endif
+	return(n);
+}
+
+#ifdef GLCD_PAGE_BAND
+/*
+ * fill the band with empty display memory
+ */
+static void glcd_BandClear(uint8_t inverted)
+{
+	for(uint8_t row = 0; row < GLCD_PAGE_BAND; row++)
+	{
+		for(glcdCoord_t x = 0; x < DISPLAY_WIDTH; x++)
+			glcd_band[row][x] = inverted ? 0xff : 0x00;
+	}
+}
+
+/**
+ * Start a picture drawn one band at a time
+ *
+ * When the library is configured for the page band (@b GLCD_PAGE_BAND) there is
+ * only RAM for GLCD_PAGE_BAND glcd memory pages (8 pixel rows each) of the display.
+ * The sketch draws its whole picture once for every band, everything
+ * drawn outside the current band is dropped:
+ *
+ * @code
+ * GLCD.FirstBand();
+ * do
+ * {
+ *	GLCD.DrawRect(0, 0, GLCD.Right, GLCD.Bottom);
+ *	GLCD.CursorTo(1, 1);
+ *	GLCD.print(value);
+ * } while(GLCD.NextBand());
+ * @endcode
+ *
+ * The drawing code must draw the same picture every time through the loop
+ * and must not depend on what is already on the display,
+ * the band starts out empty (cleared to WHITE) for every band.
+ *
+ * @see NextBand()
+ */
+
+void glcd_Device::FirstBand(void)
+{
+	glcd_bandpage = 0;
+	glcd_BandClear(this->Inverted);
+}
+
+/**
+ * Send the band and move on to the next one
+ *
+ * @return non zero when there is another band to draw,
+ *	0 when the picture is done
+ *
+ * The band is written to the display with sequential writes,
+ * the display is never read.
+ * When the picture is done, the band is ready for the next picture
+ * as if FirstBand() had been called.
+ *
+ * @see FirstBand()
+ */
+
+uint8_t glcd_Device::NextBand(void)
+{
+uint8_t row, page, chip;
+glcdCoord_t x, endx;
+
+	for(row = 0; row < GLCD_PAGE_BAND; row++)
+	{
+		page = glcd_bandpage + row;
+		if(page >= DISPLAY_HEIGHT/8)
+			break;
+		for(x = 0; x < DISPLAY_WIDTH; )
+		{
+			chip = glcd_Chip(x, page * 8);
+			endx = glcd_DevChipEndX(x);
+			this->DoGotoXY(x, page * 8);
+			for(; x < endx; x++)
+				this->DoWriteData(glcd_band[row][x], chip);
+		}
+	}
+	lcdBusEnd();
+
+	glcd_bandpage += GLCD_PAGE_BAND;
+	if(glcd_bandpage >= DISPLAY_HEIGHT/8)
+	{
+		this->FirstBand();
+		return(0);
+	}
+	glcd_BandClear(this->Inverted);
+	return(1);
+}
+#endif
+
+#ifdef GLCD_BUS_TRACE
+/**
+ * Send the recorded bus trace
+ *
+ * @param p where to send the trace, for example Serial
+ *
+ * @returns the number of bytes sent
+ *
+ * The trace is sent as binary records (see glcd_trace.h) oldest first
+ * and the buffer is emptied.
+ * If the buffer filled up since the last TraceDump() a GLCD_TRACE_LOST
+ * record is sent first to tell how many of the oldest records were dropped.
+ *
+ * @see TraceMark()
+ */
+
+uint16_t glcd_Device::TraceDump(Print &p)
+{
+uint16_t n, end;
+uint8_t rec, data, lost;
+#ifdef GLCD_ASYNC_FLUSH
+uint8_t sreg;
+
+	lcdIntSave(sreg);
+#endif
+	end = glcd_trin;			// records added while sending wait for the next dump
+	lost = glcd_trlost;
+	glcd_trlost = 0;
+#ifdef GLCD_ASYNC_FLUSH
+	lcdIntRestore(sreg);
+#endif
+
+	n = 0;
+	if(lost)
+	{
+		p.write((uint8_t) GLCD_TRACE_LOST);
+		p.write(lost);
+		n += 2;
+	}
+	for(;;)
+	{
+#ifdef GLCD_ASYNC_FLUSH
+		lcdIntSave(sreg);
+#endif
+		if((uint16_t)(glcd_trin - glcd_trout) <= (uint16_t)(glcd_trin - end))	// at end (or dropped past it)
+		{
+#ifdef GLCD_ASYNC_FLUSH
+			lcdIntRestore(sreg);
+#endif
+			break;
+		}
+		rec = glcd_trbuf[glcd_trout & (GLCD_TRACE_SIZE-1)];
+		data = glcd_trbuf[(glcd_trout+1) & (GLCD_TRACE_SIZE-1)];
+		glcd_trout += 2;
+#ifdef GLCD_ASYNC_FLUSH
+		lcdIntRestore(sreg);
+#endif
+		p.write(rec);
+		p.write(data);
+		n += 2;
+	}
+	return(n);
+}
+
+/**
+ * Put a mark in the bus trace
+ *
+ * @param id a number that identifies what the sketch is about to draw
+ *
+ * The host replay tool reports the transactions between marks separately
+ * so the cost of each part of a screen can be seen.
+ *
+ * @see TraceDump()
+ */
+
+void glcd_Device::TraceMark(uint8_t id)
+{
+	glcd_Trace(GLCD_TRACE_MARK, 0, id);
+}
+#endif
+
+#if glcd_PANEL_COUNT > 1
+/**
+ * Select the panel to draw on
+ *
+ * @param panel panel number from 0 to glcd_PANEL_COUNT-1
+ *
+ * When the panel config drives several panels (@b glcd_PANEL_COUNT) everything
+ * is drawn on the selected panel, including text areas.
+ * Each panel keeps its own x,y position, display mode and hardware scroll position
+ * and the glcd chips of every panel keep their page and column,
+ * so drawing can go back and forth between panels without repositioning the chips.
+ *
+ * Init() initializes every panel and selects panel 0.
+ */
+
+void glcd_Device::SelectPanel(uint8_t panel)
+{
+	if((panel >= glcd_PANEL_COUNT) || (panel == glcd_panel))
+		return;
+
+	glcd_panels[glcd_panel].x = this->Coord.x;
+	glcd_panels[glcd_panel].y = this->Coord.y;
+	glcd_panels[glcd_panel].inverted = this->Inverted;
+#ifdef GLCD_HW_SCROLL
+	glcd_panels[glcd_panel].startpage = glcd_startpage;
+#endif
+
+	glcd_panel = panel;
+	glcd_panelchip = panel * glcd_CHIP_COUNT;
+
+	this->Coord.x = glcd_panels[panel].x;
+	this->Coord.y = glcd_panels[panel].y;
+	this->Inverted = glcd_panels[panel].inverted;
+#ifdef GLCD_HW_SCROLL
+	glcd_startpage = glcd_panels[panel].startpage;
+#endif
+#ifdef GLCD_RMW_MODE
+	glcd_colcmd = 1;	// the last write was to another panel's chip
+#endif
+#ifdef GLCD_PAGE_CACHE
+	glcd_PcInvalidate();	// the cache only has pages of the selected panel
+#endif
+#ifdef GLCD_RLE_CACHE
+	glcd_RleInvalidate();	// the cache only has pages of the selected panel
+#endif
+}
+#endif
+
+/**
+ * Get the glcd error
+ *
+ * @return the first error since Init() or the last GetError() and clears it:
+ *	GLCD_ENOERR or GLCD_EBUSY when a glcd chip stayed busy for GLCD_BUSY_TIMEOUT status polls
+ *	or, on the I2C expander bus, GLCD_EI2C when the bus was stuck or the expander
+ *	did not acknowledge (see glcd_errno.h)
+ *
+ * The drawing functions don't return errors, they go on when a chip stays busy
+ * so a glcd problem can't hang the sketch. Call this after drawing to check on it.
+ */
+
+uint8_t glcd_Device::GetError(void)
+{
+uint8_t error;
+#ifdef GLCD_ASYNC_FLUSH
+uint8_t sreg;
+
+	lcdIntSave(sreg);	// the flush interrupt can set it
+#endif
+	error = glcd_error;
+	glcd_error = GLCD_ENOERR;
+#ifdef GLCD_I2C_BUS
+	if(!error)
+		error = lcd_i2cerror;
+	lcd_i2cerror = GLCD_ENOERR;	// send again
+#endif
+#ifdef GLCD_ASYNC_FLUSH
+	lcdIntRestore(sreg);
+#endif
+	return(error);
+}
+
+#ifdef GLCD_STATS
+/**
+ * Get the bus operation counters
+ *
+ * @return a copy of the counters
+ *
+ * The counters run from the start of the sketch or the last ResetStats().
+ * Reset them, draw something and get them to see what the drawing cost on the bus.
+ *
+ * @see ResetStats()
+ */
+
+glcdStats_t glcd_Device::GetStats(void)
+{
+glcdStats_t stats;
+#ifdef GLCD_ASYNC_FLUSH
+uint8_t sreg;
+
+	lcdIntSave(sreg);	// the flush interrupt updates the counters
+#endif
+	stats = glcd_stats;
+#ifdef GLCD_ASYNC_FLUSH
+	lcdIntRestore(sreg);
+#endif
+	return(stats);
+}
+
+/**
+ * Clear the bus operation counters
+ *
+ * @see GetStats()
+ */
+
+void glcd_Device::ResetStats(void)
+{
+#ifdef GLCD_ASYNC_FLUSH
+uint8_t sreg;
+
+	lcdIntSave(sreg);
+#endif
+	glcd_stats = glcdStats_t();
+#ifdef GLCD_ASYNC_FLUSH
+	lcdIntRestore(sreg);
 #endif
-	return data;
 }
+#endif
+
+#ifdef GLCD_HW_SCROLL
 /**
- * read a data byte from display device memory
+ * Scroll the entire display by moving the display start line
  *
- * @return the data byte at the current x,y position
+ * @param pages number of LCD pages (8 pixel rows) to scroll,
+ *	positive values scroll up and negative values scroll down.
+ * @param color color for the pages scrolled onto the display
  *
- * @note the current x,y location is not modified by the routine.
- *	This allows a read/modify/write operation.
- *	Code can call ReadData() modify the data then
- *  call WriteData() and update the same location.
+ * No pixels are moved, only the display start line is changed
+ * and the newly exposed pages are filled with color.
+ * x,y coordinates stay relative to the top of the display.
  *
- * @see WriteData()
+ * With the write back cache, the start line is sent by the next Flush().
  */
 
-#ifdef GLCD_READ_CACHE
-uint8_t glcd_Device::ReadData()
+void glcd_Device::ScrollPages(int8_t pages, uint8_t color)
 {
-uint8_t x, data;
-	x = this->Coord.x;
-	if(x >= DISPLAY_WIDTH)
-	{
-		return(0);
-	}
-	data = glcd_rdcache[this->Coord.y/8][x];
+glcdCoord_t y;
+uint8_t startpage = glcd_startpage;
+#ifdef GLCD_ASYNC_FLUSH
+uint8_t sreg;
+#endif
 
-	if(this->Inverted)
+	if(pages > 0)
 	{
-		data = ~data;
+		startpage += pages;
+		if(startpage >= DISPLAY_HEIGHT/8)
+			startpage -= DISPLAY_HEIGHT/8;
+		y = DISPLAY_HEIGHT - pages * 8;		// exposed pages at the bottom
 	}
-	return(data);
-}
-#else
-
-inline uint8_t glcd_Device::ReadData()
-{  
-uint8_t x, data;
-
-
-	x = this->Coord.x;
-	if(x >= DISPLAY_WIDTH)
+	else
 	{
-		return(0);
+		pages = -pages;
+		if(startpage < pages)
+			startpage += DISPLAY_HEIGHT/8;
+		startpage -= pages;
+		y = 0;								// exposed pages at the top
 	}
 
-	this->DoReadData();				// dummy read
-
-	data = this->DoReadData();			// "real" read
-
-	if(this->Inverted)
-	{
-		data = ~data;
-	}
+#ifdef GLCD_ASYNC_FLUSH
+	/*
+	 * The flush interrupt must not send the new start line
+	 * before the exposed pages are cleared in the cache.
+	 */
+	lcdIntSave(sreg);
+#endif
+	glcd_startpage = startpage;
 
-	this->Coord.x = -1;	// force a set column on GotoXY
+#ifndef GLCD_WRITEBACK_CACHE
+	this->DoDispStart();
+#endif
 
-	this->GotoXY(x, this->Coord.y);	
-	return(data);
-}
+	this->Coord.x = -1;	// s/w x,y now maps to a different glcd page, force a GotoXY
+	this->SetPixels(0, y, DISPLAY_WIDTH-1, y + pages * 8 - 1, color);	// (ends the bus access)
+#ifdef GLCD_ASYNC_FLUSH
+	lcdIntRestore(sreg);
 #endif
+}
 
-void glcd_Device::WriteCommand(uint8_t cmd, uint8_t chip)
+/*
+ * send the display start line to every chip of the panel
+ */
+void glcd_Device::DoDispStart(void)
 {
-	this->WaitReady(chip);
-	lcdfastWrite(glcdDI, LOW);					// D/I = 0
-	lcdfastWrite(glcdRW, LOW);					// R/W = 0	
-	lcdDataDir(0xFF);
-
-	lcdDataOut(cmd);		/* This could be done before or after raising E */
-	lcdDelayNanoseconds(GLCD_tAS);
-	glcd_DevENstrobeHi(chip);
-	lcdDelayNanoseconds(GLCD_tWH);
-	glcd_DevENstrobeLo(chip);
+	for(uint8_t chip = glcd_panelchip; chip < glcd_panelchip + glcd_CHIP_COUNT; chip++)
+		this->WriteCommand(LCD_DISP_START | (glcd_startpage * 8), chip);
+#ifdef GLCD_WRITEBACK_CACHE
+	glcd_hwstartpage = glcd_startpage;
+#endif
 }
+#endif
 
 
 /**
@@ -650,20 +2537,15 @@ void glcd_Device::WriteData(uint8_t data) {
 		return;
 	}
 
-    chip = glcd_DevXYval2Chip(this->Coord.x, this->Coord.y);
+    chip = glcd_Chip(this->Coord.x, this->Coord.y);
 	
 	yOffset = this->Coord.y%8;
 
 	if(yOffset != 0) {
+		glcd_StatUnaligned(1);
 		// first page
 		displayData = this->ReadData();
-		this->WaitReady(chip);
-   	    lcdfastWrite(glcdDI, HIGH);				// D/I = 1
-	    lcdfastWrite(glcdRW, LOW);				// R/W = 0
-		lcdDataDir(0xFF);						// data port is output
-		lcdDelayNanoseconds(GLCD_tAS);
-		glcd_DevENstrobeHi(chip);
-		
+
 #ifdef TRUE_WRITE
 		/*
 		 * Strip out bits we need to update.
@@ -676,12 +2558,7 @@ void glcd_Device::WriteData(uint8_t data) {
 		if(this->Inverted){
 			displayData = ~displayData;
 		}
-		lcdDataOut( displayData);					// write data
-		lcdDelayNanoseconds(GLCD_tWH);
-		glcd_DevENstrobeLo(chip);
-#ifdef GLCD_READ_CACHE
-		glcd_rdcache[this->Coord.y/8][this->Coord.x] = displayData; // save to read cache
-#endif
+		this->StoreData(displayData, chip);
 
 		// second page
 
@@ -689,23 +2566,19 @@ void glcd_Device::WriteData(uint8_t data) {
 		 * Make sure to goto y address of start of next page
 		 * and ensure that we don't fall off the bottom of the display.
 		 */
-		uint8_t ysave = this->Coord.y;
+		glcdCoord_t ysave = this->Coord.y;
 		if(((ysave+8) & ~7) >= DISPLAY_HEIGHT)
 		{
+			glcd_StatUnaligned(0);
 			this->GotoXY(this->Coord.x+1, ysave);
+			lcdBusEnd();
 			return;
 		}
 	
 		this->GotoXY(this->Coord.x, ((ysave+8) & ~7));
+		chip = glcd_Chip(this->Coord.x, this->Coord.y);
 
 		displayData = this->ReadData();
-		this->WaitReady(chip);
-
-   	    lcdfastWrite(glcdDI, HIGH);					// D/I = 1
-	    lcdfastWrite(glcdRW, LOW); 					// R/W = 0	
-		lcdDataDir(0xFF);				// data port is output
-		lcdDelayNanoseconds(GLCD_tAS);
-		glcd_DevENstrobeHi(chip);
 
 #ifdef TRUE_WRITE
 		/*
@@ -718,36 +2591,16 @@ void glcd_Device::WriteData(uint8_t data) {
 		if(this->Inverted){
 			displayData = ~displayData;
 		}
-		lcdDataOut(displayData);		// write data
-		lcdDelayNanoseconds(GLCD_tWH);
-		glcd_DevENstrobeLo(chip);
-#ifdef GLCD_READ_CACHE
-		glcd_rdcache[this->Coord.y/8][this->Coord.x] = displayData; // save to read cache
-#endif
+		this->StoreData(displayData, chip);
+		glcd_StatUnaligned(0);
 		this->GotoXY(this->Coord.x+1, ysave);
 	}else 
 	{
-    	this->WaitReady(chip);
-
-		lcdfastWrite(glcdDI, HIGH);				// D/I = 1
-		lcdfastWrite(glcdRW, LOW);  				// R/W = 0	
-		lcdDataDir(0xFF);						// data port is output
-
 		// just this code gets executed if the write is on a single page
 		if(this->Inverted)
 			data = ~data;	  
 
-		lcdDelayNanoseconds(GLCD_tAS);
-		glcd_DevENstrobeHi(chip);
-	
-		lcdDataOut(data);				// write data
-
-		lcdDelayNanoseconds(GLCD_tWH);
-
-		glcd_DevENstrobeLo(chip);
-#ifdef GLCD_READ_CACHE
-		glcd_rdcache[this->Coord.y/8][this->Coord.x] = data; // save to read cache
-#endif
+		this->StoreData(data, chip);
 
 		/*
 		 * NOTE/WARNING:
@@ -769,25 +2622,421 @@ void glcd_Device::WriteData(uint8_t data) {
 		 */
 
 		this->Coord.x++;
-#ifdef GLCD_XCOL_SUPPORT
-		this->Coord.chip[chip].col++;
-#endif
 
 
 		/*
-		 * Check for crossing into the next chip.
+		 * Check for crossing into the next chip
+		 * (never true on single chip panels, the compiler drops it).
 		 */
-		if( glcd_DevXYval2Chip(this->Coord.x, this->Coord.y) != chip)
+		if((this->Coord.x < DISPLAY_WIDTH) && (this->Coord.x == glcd_DevChipEndX(this->Coord.x - 1)))
 		{
-			if(this->Coord.x < DISPLAY_WIDTH)
-			{
-				uint8_t x = this->Coord.x;
-				this->Coord.x = -1;
-				this->GotoXY(x, this->Coord.y);
-			}
+			glcdCoord_t x = this->Coord.x;
+			this->Coord.x = -1;
+			this->GotoXY(x, this->Coord.y);
  		}
 	    //showXY("WrData",this->Coord.x, this->Coord.y); 
 	}
+	lcdBusEnd();
+}
+
+/**
+ * Write a buffer of bytes to display device memory
+ *
+ * @param buf pointer to the data bytes in RAM
+ * @param n number of bytes to write
+ * @param color BLACK writes the data as is, WHITE writes the complement of the data
+ *
+ * The bytes are written starting at the current x,y position
+ * and going to the right, exactly as if WriteData() were called for each byte.
+ * Bytes that would go beyond the right edge of the display are dropped.
+ *
+ * When the y position is on a page boundary, the chip crossing checks and
+ * hardware positioning are done once for each chip the data lands on rather
+ * than for every byte, and the bytes are streamed using the glcd column auto increment.
+ *
+ * @note the x,y address will not be the same as it was prior to this call.
+ * 	The y address will remain the aame but the x address will advance by n.
+ *
+ * @see WriteDataBurst_P()
+ * @see WriteData()
+ */
+
+void glcd_Device::WriteDataBurst(const uint8_t *buf, glcdCoord_t n, uint8_t color)
+{
+	this->DoWriteDataBurst(buf, n, GLCD_BURST_RAM, ~color);
+	lcdBusEnd();
+}
+
+/**
+ * Write a buffer of bytes in program memory to display device memory
+ *
+ * @param buf pointer to the data bytes in PROGMEM
+ * @param n number of bytes to write
+ * @param color BLACK writes the data as is, WHITE writes the complement of the data
+ *
+ * Identical to WriteDataBurst() except that the data is read from program memory.
+ *
+ * @see WriteDataBurst()
+ */
+
+void glcd_Device::WriteDataBurst_P(const uint8_t *buf, glcdCoord_t n, uint8_t color)
+{
+	this->DoWriteDataBurst(buf, n, GLCD_BURST_PGM, ~color);
+	lcdBusEnd();
+}
+
+/**
+ * Read a sequence of bytes from display device memory
+ *
+ * @param buf pointer to where to store the data bytes
+ * @param n number of bytes to read
+ *
+ * The bytes are read starting at the current x,y position going to the right,
+ * exactly as if ReadData() were called for each byte with the x position advancing by one.
+ * Bytes beyond the right edge of the display read as 0.
+ *
+ * Rather than a dummy read and a column reposition for every byte,
+ * only one dummy read is done for each chip the data comes from, after which
+ * the bytes are read in sequence using the glcd column auto increment.
+ *
+ * @note the current x,y location is not modified by the routine.
+ *	This allows a read/modify/write operation using WriteDataBurst().
+ *
+ * @see ReadData()
+ * @see WriteDataBurst()
+ */
+
+void glcd_Device::ReadDataBurst(uint8_t *buf, glcdCoord_t n)
+{
+glcdCoord_t x;
+uint8_t data;
+
+	x = this->Coord.x;
+
+#ifdef GLCD_READ_CACHE
+	while(n && (x < DISPLAY_WIDTH))
+	{
+		data = glcd_rdcache[glcd_Page(this->Coord.y)][x++];
+		if(this->Inverted)
+			data = ~data;
+		*buf++ = data;
+		n--;
+	}
+#elif defined(GLCD_PAGE_BAND)
+	uint8_t row = glcd_BandRow(this->Coord.y);
+
+	while(n && (x < DISPLAY_WIDTH) && (row < GLCD_PAGE_BAND))
+	{
+		data = glcd_band[row][x++];
+		if(this->Inverted)
+			data = ~data;
+		*buf++ = data;
+		n--;
+	}
+#else
+glcdCoord_t x0, endx, run;
+
+#ifdef GLCD_PAGE_CACHE
+	/*
+	 * Only when every column is cached is the glcd not read at all,
+	 * otherwise the whole burst is read and cached.
+	 */
+	uint8_t e = 0;
+
+	if(x < DISPLAY_WIDTH)
+	{
+		e = glcd_PcEntry(glcd_Page(this->Coord.y), 1);
+		endx = (n > DISPLAY_WIDTH - x) ? DISPLAY_WIDTH : x + n;
+		for(x0 = x; (x0 < endx) && glcd_PcValid(e, x0); x0++)
+			;
+		if(x0 == endx)
+		{
+			for(; x < endx; x++)
+			{
+				glcd_Stat(cachehits);
+				data = glcd_pcdata[e][x];
+				if(this->Inverted)
+					data = ~data;
+				*buf++ = data;
+				n--;
+			}
+			while(n--)
+				*buf++ = 0;
+			return;
+		}
+	}
+#endif
+#ifdef GLCD_RLE_CACHE
+	if((x < DISPLAY_WIDTH) && glcd_RleLen(glcd_Page(this->Coord.y)))
+	{
+		for(; n && (x < DISPLAY_WIDTH); n--)
+		{
+			glcd_Stat(cachehits);
+			glcd_RleGet(glcd_Page(this->Coord.y), x++, &data);
+			if(this->Inverted)
+				data = ~data;
+			*buf++ = data;
+		}
+		while(n--)
+			*buf++ = 0;
+		return;
+	}
+#endif
+
+	x0 = x;
+	while(n && (x < DISPLAY_WIDTH))
+	{
+		run = glcd_DevChipEndX(x) - x;
+		if(run > n)
+			run = n;
+		endx = x + run;
+		n -= run;
+
+#ifdef GLCD_RMW_MODE
+		uint8_t chip = glcd_Chip(x, this->Coord.y);
+
+		if(glcd_rmwchips & _BV(chip))
+			this->EndRMW(chip);		// burst reads need the column to advance
+#endif
+		this->Coord.x = -1;	// force a set column on GotoXY
+		this->GotoXY(x, this->Coord.y);
+
+		this->DoReadData();				// dummy read
+		glcd_Stat(dummyreads);
+
+		for(; x < endx; x++)
+		{
+			data = this->DoReadData();	// "real" read
+#ifdef GLCD_PAGE_CACHE
+			glcd_Stat(cachemisses);
+			glcd_PcSet(e, x, data);
+#endif
+#ifdef GLCD_RLE_CACHE
+			glcd_Stat(cachemisses);
+#endif
+			if(this->Inverted)
+				data = ~data;
+			*buf++ = data;
+		}
+	}
+
+	if(x != x0)
+	{
+		this->Coord.x = -1;	// force a set column on GotoXY
+		this->GotoXY(x0, this->Coord.y);
+	}
+#endif
+
+	while(n--)
+		*buf++ = 0;
+}
+
+/**
+ * Modify a sequence of bytes in display device memory
+ *
+ * @param n number of bytes to modify
+ * @param andmask bits to keep
+ * @param xormask bits to toggle after masking
+ *
+ * Each byte starting at the current x,y position going to the right
+ * is replaced with (data & andmask) ^ xormask.
+ * The data is moved in bursts through a small buffer using ReadDataBurst()
+ * and WriteDataBurst().
+ *
+ * @note the x,y address will not be the same as it was prior to this call.
+ * 	The y address will remain the aame but the x address will advance by n.
+ */
+
+void glcd_Device::UpdateDataBurst(glcdCoord_t n, uint8_t andmask, uint8_t xormask)
+{
+uint8_t buf[GLCD_BURST_BUFSIZE];
+uint8_t i, cnt;
+
+	if(this->Coord.x >= DISPLAY_WIDTH)
+		return;
+	if(n > DISPLAY_WIDTH - this->Coord.x)
+		n = DISPLAY_WIDTH - this->Coord.x;
+
+	while(n)
+	{
+		cnt = n > GLCD_BURST_BUFSIZE ? GLCD_BURST_BUFSIZE : n;
+		this->ReadDataBurst(buf, cnt);
+		for(i = 0; i < cnt; i++)
+			buf[i] = (buf[i] & andmask) ^ xormask;
+		this->WriteDataBurst(buf, cnt);
+		n -= cnt;
+	}
+}
+
+/*
+ * burst write engine
+ *
+ * The xor value is applied to every byte before the display Inverted mode is applied.
+ */
+void glcd_Device::DoWriteDataBurst(const uint8_t *buf, glcdCoord_t n, uint8_t mode, uint8_t xor_val)
+{
+glcdCoord_t x, endx, run;
+uint8_t chip, data;
+
+	if((this->Coord.x >= DISPLAY_WIDTH) || !n)
+		return;
+
+	if(this->Coord.y % 8)
+	{
+		/*
+		 * Data spans two LCD pages so each byte needs a read/modify/write
+		 * of both pages, let WriteData() do it.
+		 */
+		while(n--)
+		{
+			if(mode == GLCD_BURST_PGM)
+				data = pgm_read_byte(buf++);
+			else if(mode == GLCD_BURST_RAM)
+				data = *buf++;
+			else
+				data = *buf;
+			this->WriteData(data ^ xor_val);
+		}
+		return;
+	}
+
+	if(this->Inverted)
+		xor_val = ~xor_val;
+
+#ifdef GLCD_PAGE_BAND
+	/*
+	 * Store the bytes that land in the band, no chip runs or glcd positioning
+	 * are needed for that, and just move past the rest.
+	 */
+	uint8_t row = glcd_BandRow(this->Coord.y);
+
+	if(n > DISPLAY_WIDTH - this->Coord.x)
+		n = DISPLAY_WIDTH - this->Coord.x;
+	if(row >= GLCD_PAGE_BAND)
+	{
+		this->Coord.x += n;
+		return;
+	}
+	for(x = this->Coord.x; n; n--)
+	{
+		if(mode == GLCD_BURST_PGM)
+			data = pgm_read_byte(buf++);
+		else if(mode == GLCD_BURST_RAM)
+			data = *buf++;
+		else
+			data = *buf;
+		glcd_band[row][x++] = data ^ xor_val;
+	}
+	this->Coord.x = x;
+	return;
+#endif
+
+#ifdef GLCD_RLE_CACHE
+	if((mode == GLCD_BURST_FILL) && (this->Coord.x == 0) && (n >= DISPLAY_WIDTH))
+		glcd_RleFill(glcd_Page(this->Coord.y), *buf ^ xor_val);	// also caches a page that was dropped
+#endif
+
+#if defined(GLCD_CHIP_BROADCAST) && !defined(GLCD_WRITEBACK_CACHE)
+	if((mode == GLCD_BURST_FILL) && (this->Coord.x == 0) && (n >= DISPLAY_WIDTH))
+	{
+		/*
+		 * A full width fill is the same on every chip,
+		 * so write all the chips at once.
+		 */
+		uint8_t page = glcd_Page(this->Coord.y);
+
+		data = *buf ^ xor_val;
+#ifdef GLCD_READ_CACHE
+		/*
+		 * Only worth it when more bytes change than are in a single chip,
+		 * otherwise just write the bytes that changed.
+		 */
+		endx = 0;
+		for(x = 0; x < DISPLAY_WIDTH; x++)
+		{
+			if(glcd_rdcache[page][x] != data)
+				endx++;
+		}
+		if(endx > CHIP_WIDTH)
+#endif
+		{
+#ifdef GLCD_READ_CACHE
+			for(x = 0; x < DISPLAY_WIDTH; x++)
+				glcd_rdcache[page][x] = data;
+			glcd_hwx = (glcdCoord_t) -1;
+#endif
+#ifdef GLCD_PAGE_CACHE
+			uint8_t e = glcd_PcEntry(page, 1);
+			for(x = 0; x < DISPLAY_WIDTH; x++)
+				glcd_PcSet(e, x, data);
+#endif
+			this->DoWritePageAll(page, &data, GLCD_BURST_FILL);
+			this->Coord.x = DISPLAY_WIDTH;
+			return;
+		}
+	}
+#endif
+
+#ifdef GLCD_PAGE_CACHE
+	uint8_t e = glcd_PcEntry(glcd_Page(this->Coord.y), 1);
+#endif
+
+	x = this->Coord.x;
+	while(n && (x < DISPLAY_WIDTH))
+	{
+		/*
+		 * Find the end of the run of bytes on this chip
+		 */
+		chip = glcd_Chip(x, this->Coord.y);
+		run = glcd_DevChipEndX(x) - x;
+		if(run > n)
+			run = n;
+		endx = x + run;
+		n -= run;
+
+		/*
+		 * position the hardware once for the run (does nothing if already there)
+		 * then let the column auto increment step through the run.
+		 */
+		this->GotoXY(x, this->Coord.y);
+
+		for(; x < endx; x++)
+		{
+			if(mode == GLCD_BURST_PGM)
+				data = pgm_read_byte(buf++);
+			else if(mode == GLCD_BURST_RAM)
+				data = *buf++;
+			else
+				data = *buf;
+			data ^= xor_val;
+#ifdef GLCD_READ_CACHE
+			this->Coord.x = x;
+			this->StoreData(data, chip);
+#else
+#ifdef GLCD_PAGE_CACHE
+			glcd_PcSet(e, x, data);
+#endif
+#ifdef GLCD_RLE_CACHE
+			glcd_RleSet(glcd_Page(this->Coord.y), x, data);
+#endif
+			this->DoWriteData(data, chip);
+#endif
+		}
+	}
+
+	/*
+	 * Leave the s/w x coordinate just past the last byte like WriteData() does.
+	 * If that crossed into a new chip, the new chip still needs its hardware positioned.
+	 */
+	if((x < DISPLAY_WIDTH) && (x == glcd_DevChipEndX(x - 1)))
+	{
+		this->Coord.x = -1;
+		this->GotoXY(x, this->Coord.y);
+	}
+	else
+	{
+		this->Coord.x = x;
+	}
 }
 
 /*
@@ -68,10 +68,29 @@ typedef class _FlashString {} *FLASHSTRING;
  * WARNING:
  *	This is non portable code in that it will only work on little endian processors.
  *	If you use big endian you have to switch the byte ordering in the union.
+ *
+ * With wide (16 bit) coordinates, each corner gets 16 bits of the token,
+ * enough bits for x to hold DISPLAY_WIDTH-1 and the rest for y (TAREA_YBITS).
+ * The coordinates are then taken out with shifts and masks rather than the union.
  */
 
+#ifdef GLCD_WIDE_COORDS
+#if DISPLAY_WIDTH <= 256
+#define TAREA_YBITS	8
+#elif DISPLAY_WIDTH <= 512
+#define TAREA_YBITS	7
+#else
+#define TAREA_YBITS	6
+#endif
+#if DISPLAY_HEIGHT > (1 << TAREA_YBITS)
+#error "display is too large for predefined text area tokens"
+#endif
+#define MK_TareaToken(x1, y1, x2, y2) \
+	(uint32_t) (((uint32_t) (x1) << (16 + TAREA_YBITS)) | ((uint32_t)(y1) << 16) | ((uint32_t)(x2) << TAREA_YBITS) | (uint32_t)(y2))
+#else
 #define MK_TareaToken(x1, y1, x2, y2) \
 	(uint32_t) (((uint32_t) (x1) << 24) | ((uint32_t)(y1) << 16) | ((uint32_t)(x2) << 8) | (uint32_t)(y2))
+#endif
         
 /// @cond hide_from_doxygen
 typedef union
@@ -174,10 +193,10 @@ static FontCallback	FontRead;               // font callback shared across all i
 /// @cond hide_from_doxygen
 struct tarea
 {
-	uint8_t x1;
-	uint8_t y1;
-	uint8_t	x2;
-	uint8_t y2;
+	glcdCoord_t x1;
+	glcdCoord_t y1;
+	glcdCoord_t x2;
+	glcdCoord_t y2;
 	int8_t  mode;
 };
 /// @endcond
@@ -199,8 +218,8 @@ class gText : public glcd_Device
 	uint8_t			FontColor;
 	Font_t			Font;
 	struct tarea tarea;
-	uint8_t			x;
-	uint8_t			y;
+	glcdCoord_t		x;
+	glcdCoord_t		y;
 #ifndef GLCD_NODEFER_SCROLL
 	uint8_t			need_scroll; // set when text scroll has been defered
 #endif
@@ -208,15 +227,16 @@ class gText : public glcd_Device
 	void SpecialChar(uint8_t c);
 
 	// Scroll routines are private for now
-	void ScrollUp(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t pixels, uint8_t color);
-	void ScrollDown(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t pixels, uint8_t color);
+	void ScrollUp(glcdCoord_t x1, glcdCoord_t y1, glcdCoord_t x2, glcdCoord_t y2, uint8_t pixels, uint8_t color);
+	void ScrollDown(glcdCoord_t x1, glcdCoord_t y1, glcdCoord_t x2, glcdCoord_t y2, uint8_t pixels, uint8_t color);
+	void ScrollPage(glcdCoord_t x1, glcdCoord_t x2, uint8_t page, int16_t srow, uint8_t keep, uint8_t fill, uint8_t color);
 
   public:
 	gText(); // default - uses the entire display
-	gText(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, textMode mode=DEFAULT_SCROLLDIR);
+	gText(glcdCoord_t x1, glcdCoord_t y1, glcdCoord_t x2, glcdCoord_t y2, textMode mode=DEFAULT_SCROLLDIR);
 	// 4 Feb - added two constuctors (and SetFontColor below) 
 	gText(predefinedArea selection, textMode mode=DEFAULT_SCROLLDIR);
-	gText(uint8_t x1, uint8_t y1, uint8_t columns, uint8_t rows, Font_t font, textMode mode=DEFAULT_SCROLLDIR);
+	gText(glcdCoord_t x1, glcdCoord_t y1, uint8_t columns, uint8_t rows, Font_t font, textMode mode=DEFAULT_SCROLLDIR);
 
 	//void Init(glcd_Device* _device); // no longer used
 
@@ -226,8 +246,8 @@ class gText : public glcd_Device
 /*@{*/
 	// Text area functions
 
-	uint8_t DefineArea(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, textMode mode=DEFAULT_SCROLLDIR);
-	uint8_t DefineArea(uint8_t x1, uint8_t y1, uint8_t columns, uint8_t rows, Font_t font, textMode mode=DEFAULT_SCROLLDIR);
+	uint8_t DefineArea(glcdCoord_t x1, glcdCoord_t y1, glcdCoord_t x2, glcdCoord_t y2, textMode mode=DEFAULT_SCROLLDIR);
+	uint8_t DefineArea(glcdCoord_t x1, glcdCoord_t y1, uint8_t columns, uint8_t rows, Font_t font, textMode mode=DEFAULT_SCROLLDIR);
 	uint8_t DefineArea(predefinedArea selection, textMode mode=DEFAULT_SCROLLDIR);
 	void SetTextMode(textMode mode); // change to the given text mode
 	void ClearArea(void);
@@ -239,9 +259,9 @@ class gText : public glcd_Device
 	void Puts(char *str);
 	void Puts(const String &str); // for Arduino String Class
 	void Puts_P(PGM_P str);
-	void DrawString(char *str, uint8_t x, uint8_t y);
-	void DrawString(String &str, uint8_t x, uint8_t y); // for Arduino String class
-	void DrawString_P(PGM_P str, uint8_t x, uint8_t y);
+	void DrawString(char *str, glcdCoord_t x, glcdCoord_t y);
+	void DrawString(String &str, glcdCoord_t x, glcdCoord_t y); // for Arduino String class
+	void DrawString_P(PGM_P str, glcdCoord_t x, glcdCoord_t y);
 
 #if ARDUINO < 100
 	void write(uint8_t c);  // character output for print base class
@@ -251,7 +271,7 @@ class gText : public glcd_Device
 
 	void CursorTo( uint8_t column, uint8_t row); // 0 based coordinates for character columns and rows
 	void CursorTo( int8_t column); // move cursor on the current row
-	void CursorToXY( uint8_t x, uint8_t y); // coordinates relative to active text area
+	void CursorToXY( glcdCoord_t x, glcdCoord_t y); // coordinates relative to active text area
 	uint8_t CharWidth(uint8_t c);
 	uint16_t StringWidth(const char* str);
 	uint16_t StringWidth_P(PGM_P str);
@@ -29,6 +29,243 @@
 
 #include "glcd_Config.h"
 
+/*
+ * Double buffering uses the write back cache frame buffer as the back buffer.
+ * The asynchronous flush would send frames that are still being drawn.
+ */
+#ifdef GLCD_DOUBLE_BUFFER
+#ifdef GLCD_ASYNC_FLUSH
+#error "GLCD_DOUBLE_BUFFER can't be used with GLCD_ASYNC_FLUSH"
+#endif
+#ifndef GLCD_WRITEBACK_CACHE
+#define GLCD_WRITEBACK_CACHE
+#endif
+#endif
+
+/*
+ * The asynchronous flush sends the write back cache frame buffer.
+ */
+#if defined(GLCD_ASYNC_FLUSH) && !defined(GLCD_WRITEBACK_CACHE)
+#define GLCD_WRITEBACK_CACHE
+#endif
+
+/*
+ * The write back cache draws into the read cache frame buffer
+ * so it always needs the read cache.
+ */
+#if defined(GLCD_WRITEBACK_CACHE) && !defined(GLCD_READ_CACHE)
+#define GLCD_READ_CACHE
+#endif
+
+/*
+ * Several panels of the configured type can share the data, DI, RW and EN lines
+ * when the chips of each panel have chip selects of their own (glcd_PANEL_COUNT in the
+ * panel config). Chip c of panel n uses chip select string glcd_CHIP<n*glcd_CHIP_COUNT+c>.
+ * The frame buffers are the size of one panel, so they can't be used with more.
+ */
+#ifndef glcd_PANEL_COUNT
+#define glcd_PANEL_COUNT	1
+#endif
+#define glcd_TOTAL_CHIPS	(glcd_CHIP_COUNT * glcd_PANEL_COUNT)
+
+/*
+ * Pixel coordinates, widths and heights are 8 bits unless the display is
+ * more than 255 pixels wide or high, then they are 16 bits (GLCD_WIDE_COORDS).
+ * GLCD_WIDE_COORDS can also be turned on for smaller displays (to check the wide build).
+ */
+#if (DISPLAY_WIDTH > 255) || (DISPLAY_HEIGHT > 255)
+#ifndef GLCD_WIDE_COORDS
+#define GLCD_WIDE_COORDS
+#endif
+#endif
+
+#ifdef GLCD_WIDE_COORDS
+typedef uint16_t glcdCoord_t;
+typedef int16_t glcdDelta_t;	// signed coordinate difference
+#else
+typedef uint8_t glcdCoord_t;
+typedef int8_t glcdDelta_t;
+#endif
+
+#if glcd_PANEL_COUNT > 1
+#ifndef glcd_CHIP0
+#error "glcd_PANEL_COUNT needs chip select strings (glcd_CHIPn) for the chips of every panel"
+#endif
+#ifdef GLCD_READ_CACHE
+#error "GLCD_READ_CACHE and GLCD_WRITEBACK_CACHE can't be used with more than one panel"
+#endif
+#endif
+
+/*
+ * busy handling modes (GLCD_BUSYMODE)
+ */
+#define GLCD_BUSY_STATUS	0	// poll the status register before every access
+#define GLCD_BUSY_TIMED		1	// never read status, wait out the device busy times
+#define GLCD_BUSY_HYBRID	2	// only poll status when the busy time may not have elapsed
+#define GLCD_BUSY_ADAPTIVE	3	// only poll status on chips that Init() found busy
+
+/*
+ * A panel config that defines a shift register latch pin uses the
+ * shift register bus and one that defines an I2C address uses the
+ * I2C port expander bus (see glcd_io.h).
+ * Both are serial buses that send the control lines along with the data
+ * and can't read anything from the glcd.
+ * So the read cache (or the page band) supplies the data reads, the busy times are waited out
+ * rather than polled and the status checks during initialization are not done.
+ */
+#if defined(glcdSPI_LATCH)
+#define GLCD_SPI_BUS
+#define GLCD_SERIAL_BUS
+#elif defined(glcdI2C_ADDR)
+#define GLCD_I2C_BUS
+#define GLCD_SERIAL_BUS
+#endif
+
+#ifdef GLCD_SERIAL_BUS
+#if !defined(GLCD_READ_CACHE) && !defined(GLCD_PAGE_BAND)
+#define GLCD_READ_CACHE
+#endif
+#ifndef GLCD_BUSYMODE
+#define GLCD_BUSYMODE GLCD_BUSY_TIMED
+#elif GLCD_BUSYMODE != GLCD_BUSY_TIMED
+#error "serial buses can't read the glcd status, use GLCD_BUSY_TIMED"
+#endif
+#ifndef GLCD_NOINIT_CHECKS
+#define GLCD_NOINIT_CHECKS
+#endif
+#endif
+
+#ifndef GLCD_BUSYMODE
+#define GLCD_BUSYMODE GLCD_BUSY_STATUS
+#endif
+
+/*
+ * The page band ("picture loop") draws into a RAM band of GLCD_PAGE_BAND glcd
+ * memory pages rather than a frame buffer of the whole display.
+ * The sketch draws its picture once for each band between FirstBand() and NextBand(),
+ * what lands outside the band is dropped and NextBand() sends the band to the glcd
+ * with sequential writes. The glcd is never read.
+ * Nothing is kept from one picture to the next, so text areas can't scroll
+ * and the display start line is not used.
+ */
+#ifdef GLCD_PAGE_BAND
+#if (GLCD_PAGE_BAND < 1) || (GLCD_PAGE_BAND > DISPLAY_HEIGHT/8)
+#error "GLCD_PAGE_BAND must be from 1 to the number of glcd memory pages"
+#endif
+#ifdef GLCD_READ_CACHE
+#error "GLCD_PAGE_BAND can't be used with GLCD_READ_CACHE or GLCD_WRITEBACK_CACHE"
+#endif
+#if glcd_PANEL_COUNT > 1
+#error "GLCD_PAGE_BAND can't be used with more than one panel"
+#endif
+#ifndef GLCD_NO_HWSCROLL
+#define GLCD_NO_HWSCROLL
+#endif
+#endif
+
+/*
+ * The page cache keeps GLCD_PAGE_CACHE glcd memory pages of display memory,
+ * the least recently used page is replaced when another page is needed.
+ * It is write through, the glcd is always up to date.
+ */
+#ifdef GLCD_PAGE_CACHE
+#if (GLCD_PAGE_CACHE < 1) || (GLCD_PAGE_CACHE > DISPLAY_HEIGHT/8)
+#error "GLCD_PAGE_CACHE must be from 1 to the number of glcd memory pages"
+#endif
+#if defined(GLCD_READ_CACHE) || defined(GLCD_PAGE_BAND)
+#error "GLCD_PAGE_CACHE can't be used with GLCD_READ_CACHE, GLCD_WRITEBACK_CACHE, GLCD_PAGE_BAND or a serial bus"
+#endif
+#endif
+
+/*
+ * The run length encoded cache keeps all of display memory in a pool of
+ * GLCD_RLE_CACHE bytes, pages that don't fit are read from the glcd.
+ * It is write through like the page cache.
+ */
+#ifdef GLCD_RLE_CACHE
+#if defined(GLCD_READ_CACHE) || defined(GLCD_PAGE_BAND) || defined(GLCD_PAGE_CACHE)
+#error "GLCD_RLE_CACHE can't be used with GLCD_READ_CACHE, GLCD_WRITEBACK_CACHE, GLCD_PAGE_BAND, GLCD_PAGE_CACHE or a serial bus"
+#endif
+#endif
+
+/*
+ * Status polls before a busy wait gives up and the access goes ahead
+ * with a GLCD_EBUSY error (see GetError()).
+ * A poll takes well under a microsecond on a 16Mhz AVR so the default is
+ * hundreds of times the longest busy time of any supported controller.
+ */
+#ifndef GLCD_BUSY_TIMEOUT
+#define GLCD_BUSY_TIMEOUT	2000
+#endif
+
+/*
+ * In GLCD_BUSY_ADAPTIVE mode, chips that skip their status polls still
+ * get polled every GLCD_BUSY_CHECK accesses (must be a power of 2)
+ * to catch a chip that has slowed down.
+ */
+#ifndef GLCD_BUSY_CHECK
+#define GLCD_BUSY_CHECK		16
+#endif
+
+/*
+ * Track the hardware X/column of each chip to minimize set column commands.
+ * Every data read (including the dummy read) and write advances the
+ * tracked column just like the hardware does.
+ * This changes the layout of lcdCoord so it must be defined here rather
+ * than in the .cpp file to keep all the modules in agreement.
+ */
+#define GLCD_XCOL_SUPPORT
+
+/*
+ * When the panel config provides a chip select string that selects every chip
+ * at once (glcd_CHIPALL), full width pages that are identical on every chip
+ * are written to all the chips together.
+ * This only works when the chips sit side by side and fill the display width
+ * and there is only one panel.
+ * The write strobes the one shared enable and sets column 0 on every chip,
+ * so the device header must declare that its chips allow it (glcd_DevChipAll).
+ */
+#if defined(glcd_CHIPALL) && !defined(glcd_DevChipAll)
+#error "glcd_CHIPALL is only supported on controllers with a shared glcdEN and chips that start at column 0"
+#endif
+#if defined(glcd_CHIPALL) && (CHIP_WIDTH * glcd_CHIP_COUNT == DISPLAY_WIDTH) && (glcd_PANEL_COUNT == 1)
+#define GLCD_CHIP_BROADCAST
+#endif
+
+/*
+ * The first x to the right of x that is on another chip, or DISPLAY_WIDTH.
+ * The chips of every supported controller sit on a CHIP_WIDTH grid so the end
+ * of a run of bytes on one chip is known without mapping each x to its chip.
+ * On single chip panels and chips stacked vertically it is a constant.
+ */
+#if (glcd_CHIP_COUNT == 1) || (CHIP_WIDTH >= DISPLAY_WIDTH)
+#define glcd_DevChipEndX(x)	(DISPLAY_WIDTH)
+#elif (DISPLAY_WIDTH % CHIP_WIDTH) == 0
+#define glcd_DevChipEndX(x)	(((x) / CHIP_WIDTH + 1) * CHIP_WIDTH)
+#else
+#define glcd_DevChipEndX(x)	\
+	(((x) / CHIP_WIDTH + 1) * CHIP_WIDTH < DISPLAY_WIDTH ? ((x) / CHIP_WIDTH + 1) * CHIP_WIDTH : DISPLAY_WIDTH)
+#endif
+
+/*
+ * The whole display can be scrolled by whole LCD pages by moving the
+ * display start line when the start line of every chip wraps at the
+ * bottom of the display.
+ */
+#if defined(glcd_DevRowWrap) && (glcd_DevRowWrap == DISPLAY_HEIGHT) && \
+	(CHIP_HEIGHT == DISPLAY_HEIGHT) && !defined(GLCD_NO_HWSCROLL)
+#define GLCD_HW_SCROLL
+#endif
+
+/*
+ * Controllers with a read-modify-write mode (LCD_RMW) use it for
+ * column sequential read/modify/write runs.
+ * With the read cache or the page band, data is never read back so the mode is not needed.
+ */
+#if defined(LCD_RMW) && !defined(GLCD_READ_CACHE) && !defined(GLCD_PAGE_BAND)
+#define GLCD_RMW_MODE
+#endif
+
 #if defined WIRING
 #include <WPrint.h> // used when deriving this class in Wiring
 #else
@@ -47,18 +284,88 @@
 #define BLACK				0xFF
 #define WHITE				0x00
 
+/*
+ * Size of the stack buffers used to move display memory
+ * in bursts during read/modify/write operations
+ */
+#define GLCD_BURST_BUFSIZE	16
+
+/*
+ * Maximum number of frame buffer columns sent to the glcd
+ * by each FlushStep()
+ * With the asynchronous flush this bounds the time spent in each interrupt.
+ */
+#ifndef GLCD_FLUSH_CHUNK
+#define GLCD_FLUSH_CHUNK	8
+#endif
+
+/*
+ * Asynchronous flush interrupt rate in Hz
+ */
+#ifndef GLCD_ASYNC_HZ
+#define GLCD_ASYNC_HZ		2000
+#endif
+
+#ifdef GLCD_ASYNC_FLUSH
+void glcd_FlushISR(void);	// timer interrupt body of the asynchronous flush
+#endif
+
+/*
+ * Size in bytes of the bus trace ring buffer (2 bytes per transaction)
+ * Must be a power of 2.
+ */
+#ifdef GLCD_BUS_TRACE
+#ifndef GLCD_TRACE_SIZE
+#define GLCD_TRACE_SIZE		256
+#endif
+#if (GLCD_TRACE_SIZE & (GLCD_TRACE_SIZE - 1)) || GLCD_TRACE_SIZE < 2 || GLCD_TRACE_SIZE > 32768
+#error "GLCD_TRACE_SIZE must be a power of 2 from 2 to 32768"
+#endif
+#include "include/glcd_trace.h"
+#endif
+
 /// @cond hide_from_doxygen
 typedef struct {
-	uint8_t x;
-	uint8_t y;
+	glcdCoord_t x;
+	glcdCoord_t y;
 	struct {
 #ifdef GLCD_XCOL_SUPPORT
 		uint8_t col;
 #endif
 		uint8_t page;
-	} chip[glcd_CHIP_COUNT];
+	} chip[glcd_TOTAL_CHIPS];	// every chip of every panel
 } lcdCoord;
 /// @endcond
+
+#ifdef GLCD_STATS
+#define GLCD_BUSY_BINS	8	// busy histogram bins: 0, 1, 2-3, 4-7, 8-15, 16-31, 32-63, 64 or more polls
+
+/**
+ * @brief glcd bus operation counters
+ *
+ * Returned by GLCD.GetStats() when GLCD_STATS is turned on.
+ * Commands and data writes sent to all the chips at once count once.
+ */
+typedef struct
+{
+	uint32_t cmds;			///< all commands
+	uint32_t pagecmds;		///< set page commands (included in cmds)
+	uint32_t colcmds;		///< set column commands (included in cmds)
+	uint32_t reads;			///< data reads
+	uint32_t dummyreads;	///< dummy data reads (included in reads)
+	uint32_t writes;		///< data writes
+	uint32_t unaligned;		///< data writes of a byte merged for a y that is not on a page boundary (included in writes)
+	uint32_t chipswitches;	///< accesses to a different chip than the previous access
+	uint32_t busypolls;		///< status polls that found the chip busy
+	uint32_t busytimeouts;	///< busy waits that gave up after GLCD_BUSY_TIMEOUT polls
+#if defined(GLCD_PAGE_CACHE) || defined(GLCD_RLE_CACHE)
+	uint32_t cachehits;		///< data bytes read from the page cache or run length encoded cache instead of the glcd
+	uint32_t cachemisses;	///< data bytes read from the glcd (cached by the page cache)
+	uint32_t cacheevictions;	///< cached pages replaced by another page or dropped for lack of room
+#endif
+	uint16_t busyhist[glcd_TOTAL_CHIPS][GLCD_BUSY_BINS];	///< busy waits per chip by polls that found it busy (stops at 65535)
+} glcdStats_t;
+#endif
 	
 /*
  * Note that all data in glcd_Device is static so that all derived instances  
@@ -77,29 +384,78 @@ class glcd_Device : public Print
   private:
   // Control functions
 	uint8_t DoReadData(void);
+	void DoWriteData(uint8_t data, uint8_t chip);
+	void DoGotoXY(glcdCoord_t x, glcdCoord_t y);
+	void StoreData(uint8_t data, uint8_t chip);
+	void DoWriteDataBurst(const uint8_t *buf, glcdCoord_t n, uint8_t mode, uint8_t xor_val);
+#ifdef GLCD_CHIP_BROADCAST
+	void DoWriteAll(uint8_t data, uint8_t di);
+	void DoWritePageAll(uint8_t page, const uint8_t *buf, uint8_t mode);
+#endif
+#ifdef GLCD_HW_SCROLL
+	void DoDispStart(void);
+#endif
+#ifdef GLCD_RMW_MODE
+	void EndRMW(uint8_t chip);
+#endif
 	void WriteCommand(uint8_t cmd, uint8_t chip);
 	inline void Enable(void);
 	inline void SelectChip(uint8_t chip); 
-	void WaitReady(uint8_t chip);
+	uint8_t WaitReady(uint8_t chip);
 	uint8_t GetStatus(uint8_t chip);
 #if ARDUINO < 100
 	void write(uint8_t); // for Print base class
 #else
 	size_t write(uint8_t); // for Print base class
 #endif
+#ifdef GLCD_ASYNC_FLUSH
+	friend void glcd_FlushISR(void);
+#endif
 	
   public:
     glcd_Device();
 	protected: 
     int Init(uint8_t invert = false);      // now public, default is non-inverted
-	void SetDot(uint8_t x, uint8_t y, uint8_t color);
-	void SetPixels(uint8_t x, uint8_t y,uint8_t x1, uint8_t y1, uint8_t color);
+	void SetDot(glcdCoord_t x, glcdCoord_t y, uint8_t color);
+	void SetPixels(glcdCoord_t x, glcdCoord_t y, glcdCoord_t x1, glcdCoord_t y1, uint8_t color);
     uint8_t ReadData(void);        // now public
     void WriteData(uint8_t data); 
+	void WriteDataBurst(const uint8_t *buf, glcdCoord_t n, uint8_t color = BLACK);
+	void WriteDataBurst_P(const uint8_t *buf, glcdCoord_t n, uint8_t color = BLACK);
+	void ReadDataBurst(uint8_t *buf, glcdCoord_t n);
+	void UpdateDataBurst(glcdCoord_t n, uint8_t andmask, uint8_t xormask);
+	void Flush(void);
+	uint8_t FlushStep(void);
+	uint16_t FlushPending(void);
+	void Present(void);
+	void SetFrameRate(uint8_t fps);
+#ifdef GLCD_PAGE_BAND
+	void FirstBand(void);
+	uint8_t NextBand(void);
+#endif
+#ifdef GLCD_BUS_TRACE
+	uint16_t TraceDump(Print &p);
+	void TraceMark(uint8_t id);
+#endif
+	uint8_t GetError(void);
+#ifdef GLCD_STATS
+	glcdStats_t GetStats(void);
+	void ResetStats(void);
+#endif
+#ifdef GLCD_HW_SCROLL
+	void ScrollPages(int8_t pages, uint8_t color);
+#endif
+#if glcd_PANEL_COUNT > 1
+	void SelectPanel(uint8_t panel);
+#endif
 
-  	void GotoXY(uint8_t x, uint8_t y);   
+  	void GotoXY(glcdCoord_t x, glcdCoord_t y);   
     static lcdCoord	  	Coord;  
 	static uint8_t	 	Inverted; 
+#ifdef GLCD_WRITE_COUNTS
+	static uint32_t		WritesSent;		// data bytes written to the glcd
+	static uint32_t		WritesSkipped;	// data bytes not written since glcd memory already had them
+#endif
 };
   
 #endif
@@ -33,9 +33,10 @@
 
 #define GLCD_ENOERR		0	// no error This must be 0. Do not change!
 
-#define GLCD_EBUSY		1	// glcd BUSY wait timeout
+#define GLCD_EBUSY		1	// glcd BUSY wait timeout (also GLCD.GetError() after a drawing call)
 #define GLCD_ERESET		2	// glcd RESET wait timeout
 #define GLCD_EINVAL		3	// invalid argument
+#define GLCD_EI2C		4	// I2C expander bus stuck or the expander did not acknowledge (also GLCD.GetError())
 
 
 
@@ -141,8 +141,312 @@
 #define lcdUnReset()		
 #endif
 
+/*
+ * Write two pins.
+ * When both pins are in the same AVR port, both bits are updated with
+ * a single write of the port register so the lines change together.
+ * Like the other avrio primitives, this only generates good code for constants.
+ *
+ * The merged write is a read/modify/write of the port register which is
+ * not atomic, so it is not used when GLCD_ATOMIC_IO is defined.
+ */
+#define lcdfastWrite2(pin1, val1, pin2, val2) lcd_avrWrite2Pins(pin1, val1, pin2, val2)
+
+static inline volatile uint8_t *lcd_avrPortReg(uint8_t avrport) __attribute__((always_inline));
+static inline void lcd_avrWrite2Pins(avrpin_t pin1, uint8_t val1, avrpin_t pin2, uint8_t val2) __attribute__((always_inline));
+
+volatile uint8_t *
+lcd_avrPortReg(uint8_t avrport)
+{
+#ifdef PORTA
+	if(avrport == AVRIO_PORTA)
+		return(&PORTA);
+#endif
+#ifdef PORTB
+	if(avrport == AVRIO_PORTB)
+		return(&PORTB);
+#endif
+#ifdef PORTC
+	if(avrport == AVRIO_PORTC)
+		return(&PORTC);
+#endif
+#ifdef PORTD
+	if(avrport == AVRIO_PORTD)
+		return(&PORTD);
+#endif
+#ifdef PORTE
+	if(avrport == AVRIO_PORTE)
+		return(&PORTE);
+#endif
+#ifdef PORTF
+	if(avrport == AVRIO_PORTF)
+		return(&PORTF);
+#endif
+#ifdef PORTG
+	if(avrport == AVRIO_PORTG)
+		return(&PORTG);
+#endif
+#ifdef PORTH
+	if(avrport == AVRIO_PORTH)
+		return(&PORTH);
+#endif
+#ifdef PORTI
+	if(avrport == AVRIO_PORTI)
+		return(&PORTI);
+#endif
+#ifdef PORTJ
+	if(avrport == AVRIO_PORTJ)
+		return(&PORTJ);
+#endif
+#ifdef PORTK
+	if(avrport == AVRIO_PORTK)
+		return(&PORTK);
+#endif
+#ifdef PORTL
+	if(avrport == AVRIO_PORTL)
+		return(&PORTL);
+#endif
+	return(0);
+}
+
+void
+lcd_avrWrite2Pins(avrpin_t pin1, uint8_t val1, avrpin_t pin2, uint8_t val2)
+{
+#ifndef GLCD_ATOMIC_IO
+	if(AVRIO_PIN2AVRPORT(pin1) == AVRIO_PIN2AVRPORT(pin2))
+	{
+		volatile uint8_t *port = lcd_avrPortReg(AVRIO_PIN2AVRPORT(pin1));
+		uint8_t mask = AVRIO_PIN2AVRBITMASK(pin1) | AVRIO_PIN2AVRBITMASK(pin2);
+		uint8_t bits = (val1 ? AVRIO_PIN2AVRBITMASK(pin1) : 0) | (val2 ? AVRIO_PIN2AVRBITMASK(pin2) : 0);
+
+		if(port)
+		{
+			*port = (*port & ~mask) | bits;
+			return;
+		}
+	}
+#endif
+	avrio_WritePin(pin1, val1);
+	avrio_WritePin(pin2, val2);
+}
+
 #endif // _AVRIO_AVRIO_
 
+#ifdef GLCD_SPI_BUS
+/*
+ * Shift register bus
+ *
+ * The data lines and the control lines assigned to SR_Qn go out
+ * over hardware SPI to two chained 74HC595 shift registers:
+ * MOSI -> data register (D0-D7) -> control register (SR_Q0-SR_Q7).
+ * Both registers are loaded together by pulsing the latch (glcdSPI_LATCH) pin.
+ *
+ * Control line changes only update the control register shadow.
+ * They go out with the next data byte, so a control change, the data byte
+ * and the latch pulse are a single transfer.
+ * The EN strobe is a normal pin; raising it first sends any control
+ * changes that have not gone out yet.
+ *
+ * Nothing can be read back so lcdDataIn() and the busy status always return 0.
+ * glcd_Device.h makes sure they are never used.
+ */
+
+#define SR_Q0	0x200	// beyond any avrio pin number
+#define SR_Q1	0x201
+#define SR_Q2	0x202
+#define SR_Q3	0x203
+#define SR_Q4	0x204
+#define SR_Q5	0x205
+#define SR_Q6	0x206
+#define SR_Q7	0x207
+
+extern uint8_t lcd_spictl;		// control register shadow
+extern uint8_t lcd_spidata;		// data register shadow
+extern uint8_t lcd_spidirty;	// control register shadow not sent yet
+
+static inline void lcd_spiShift(uint8_t data) __attribute__((always_inline));
+static inline void lcd_spiWritePin(avrpin_t pin, uint8_t val) __attribute__((always_inline));
+static inline void lcd_spiPinMode(avrpin_t pin, uint8_t mode) __attribute__((always_inline));
+
+void
+lcd_spiShift(uint8_t data)
+{
+	SPDR = lcd_spictl;	// first byte ends up in the last register of the chain
+	lcd_spidata = data;
+	while(!(SPSR & _BV(SPIF)))
+		;
+	SPDR = data;
+	lcd_spidirty = 0;
+	while(!(SPSR & _BV(SPIF)))
+		;
+	avrio_WritePin(glcdSPI_LATCH, 1);
+	avrio_WritePin(glcdSPI_LATCH, 0);
+}
+
+void
+lcd_spiWritePin(avrpin_t pin, uint8_t val)
+{
+	if(pin >= SR_Q0)
+	{
+		if(val)
+			lcd_spictl |= _BV(pin - SR_Q0);
+		else
+			lcd_spictl &= ~_BV(pin - SR_Q0);
+		lcd_spidirty = 1;
+	}
+	else
+	{
+		if(lcd_spidirty)
+			lcd_spiShift(lcd_spidata);	// control lines must settle before a strobe
+		avrio_WritePin(pin, val);
+	}
+}
+
+void
+lcd_spiPinMode(avrpin_t pin, uint8_t mode)
+{
+	if(pin < SR_Q0)
+		avrio_PinMode(pin, mode);
+}
+
+/*
+ * replace the parallel bus primitives
+ */
+#undef lcdfastWrite
+#undef lcdfastWrite2
+#undef lcdPinMode
+#undef lcdDataDir
+#undef lcdDataOut
+#undef lcdDataIn
+#undef lcdRdBusystatus
+#undef lcdReset
+#undef lcdUnReset
+
+#define lcdfastWrite(pin, pinval)	lcd_spiWritePin(pin, pinval)
+#define lcdfastWrite2(pin1, val1, pin2, val2) \
+ do {lcd_spiWritePin(pin1, val1); lcd_spiWritePin(pin2, val2);} while(0)
+#define lcdPinMode(pin, mode)		lcd_spiPinMode(pin, mode)
+#define lcdDataDir(dirbits)			// data lines are always outputs
+#define lcdDataOut(data)			lcd_spiShift(data)
+#define lcdDataIn()					(0)
+#define lcdRdBusystatus()			(0)
+
+#ifdef glcdRES
+#define lcdReset()		do {lcd_spiWritePin(glcdRES, 0); lcd_spiShift(lcd_spidata);} while(0)
+#define lcdUnReset()	do {lcd_spiWritePin(glcdRES, 1); lcd_spiShift(lcd_spidata);} while(0)
+#else
+#define lcdReset()		
+#define lcdUnReset()		
+#endif
+
+/*
+ * SPI master at the fastest clock (F_CPU/2), mode 0, MSB first.
+ * SS must be an output to stay master, it is a good choice for the latch.
+ */
+#define lcdBusInit() 							\
+do {											\
+	pinMode(SS, OUTPUT);						\
+	pinMode(MOSI, OUTPUT);						\
+	pinMode(SCK, OUTPUT);						\
+	avrio_PinMode(glcdSPI_LATCH, OUTPUT);		\
+	avrio_WritePin(glcdSPI_LATCH, 0);			\
+	SPCR = _BV(SPE) | _BV(MSTR);				\
+	SPSR = _BV(SPI2X);							\
+} while(0)
+
+#endif // GLCD_SPI_BUS
+
+#ifdef GLCD_I2C_BUS
+/*
+ * I2C port expander bus
+ *
+ * The expander protocol is in mcp23017_io.h, this supplies the I2C byte
+ * primitives it uses directly on the TWI hardware.
+ * The Wire library is not used as its 32 byte buffer would split
+ * the long expander writes into many short ones.
+ */
+#ifndef GLCD_I2C_HZ
+#define GLCD_I2C_HZ	400000	// the MCP23017 goes up to 1.7Mhz
+#endif
+
+/*
+ * TWI status codes (TWSR with the prescaler bits masked off)
+ */
+#define LCD_TW_START		0x08	// START sent
+#define LCD_TW_RESTART		0x10	// repeated START sent
+#define LCD_TW_SLA_ACK		0x18	// address sent, ACK received
+#define LCD_TW_DATA_ACK		0x28	// data sent, ACK received
+#define lcd_i2cStatus()		(TWSR & 0xf8)
+
+#define lcd_i2cInit()							\
+do {											\
+	TWSR = 0;									\
+	TWBR = ((F_CPU / GLCD_I2C_HZ) - 16) / 2;	\
+	TWCR = _BV(TWEN);							\
+} while(0)
+
+/*
+ * Wait for the TWI hardware like WaitReady() waits for a chip, giving up
+ * after GLCD_BUSY_TIMEOUT polls so a held SDA or SCL line can't hang the sketch.
+ * Any failure sets lcd_i2cerror (GLCD.GetError() returns it) and nothing
+ * more is sent until it is cleared, so a dead bus costs one timeout.
+ */
+#define lcd_i2cWait(busy)						\
+do {											\
+	uint16_t polls = GLCD_BUSY_TIMEOUT;			\
+	while(busy)									\
+	{											\
+		if(!--polls)							\
+		{										\
+			lcd_i2cerror = GLCD_EI2C;			\
+			break;								\
+		}										\
+	}											\
+} while(0)
+
+#define lcd_i2cStart()							\
+do {											\
+	if(lcd_i2cerror)							\
+		break;									\
+	TWCR = _BV(TWINT) | _BV(TWSTA) | _BV(TWEN);	\
+	lcd_i2cWait(!(TWCR & _BV(TWINT)));			\
+	if((lcd_i2cStatus() != LCD_TW_START) && (lcd_i2cStatus() != LCD_TW_RESTART))	\
+		lcd_i2cerror = GLCD_EI2C;				\
+} while(0)
+
+/*
+ * the address byte and the data bytes must all be acknowledged
+ */
+#define lcd_i2cWrite(byte)						\
+do {											\
+	if(lcd_i2cerror)							\
+		break;									\
+	TWDR = (byte);								\
+	TWCR = _BV(TWINT) | _BV(TWEN);				\
+	lcd_i2cWait(!(TWCR & _BV(TWINT)));			\
+	if((lcd_i2cStatus() != LCD_TW_SLA_ACK) && (lcd_i2cStatus() != LCD_TW_DATA_ACK))	\
+		lcd_i2cerror = GLCD_EI2C;				\
+} while(0)
+
+#define lcd_i2cStop()							\
+do {											\
+	if(lcd_i2cerror)							\
+		break;									\
+	TWCR = _BV(TWINT) | _BV(TWSTO) | _BV(TWEN);	\
+	lcd_i2cWait(TWCR & _BV(TWSTO));				\
+} while(0)
+
+#include "include/mcp23017_io.h"
+#endif // GLCD_I2C_BUS
+
+/*
+ * Buses that batch up glcd accesses into longer transfers
+ * are told when a group of accesses is done.
+ */
+#ifndef lcdBusEnd
+#define lcdBusEnd()
+#endif
+
 /*
  * Delay functions
  */
@@ -167,6 +471,49 @@
 
 #define lcdDelayMilliseconds(__ms) delay(__ms)	// Arduino delay function
 
+/*
+ * Free running 8 bit tick counter used by the timed busy modes
+ * to tell how much time has passed since a chip was last strobed.
+ *
+ * The Arduino core runs timer0 with a prescaler of 64 for millis()
+ * so the counter can be read directly without any overhead.
+ * If there is no usable timer, lcdTimerTicks() is left undefined and the
+ * timed busy modes always wait the full busy time.
+ */
+#if !defined(lcdTimerTicks) && defined(TCNT0) && defined(F_CPU)
+#define lcdTimerTicks()		TCNT0
+#define lcdTimerTickNs		(64000000000ULL / F_CPU)	// nanoseconds per tick
+#endif
+
+/*
+ * Interrupt masking used to keep the asynchronous flush interrupt
+ * from running in the middle of a frame buffer or glcd update.
+ */
+#if !defined(lcdIntSave) && defined(SREG)
+#define lcdIntSave(sreg)	do { sreg = SREG; cli(); } while(0)
+#define lcdIntRestore(sreg)	do { SREG = sreg; } while(0)
+#endif
+
+/*
+ * Timer that runs the asynchronous flush (GLCD_ASYNC_FLUSH)
+ *
+ * timer2 is used in CTC mode since timer0 and timer1 are used by the
+ * Arduino core and Servo library.
+ * This takes timer2 away from tone() and PWM on its pins.
+ * If there is no timer2, lcdAsyncTimerInit() is left undefined and
+ * the sketch must call glcd_FlushISR() from its own timer interrupt.
+ */
+#if defined(GLCD_ASYNC_FLUSH) && !defined(lcdAsyncTimerInit) && defined(OCR2A) && defined(TIMSK2) && defined(F_CPU)
+#define lcdAsyncTimerVect	TIMER2_COMPA_vect
+#define lcdAsyncTimerInit() 					\
+do {											\
+	TCCR2A = _BV(WGM21);	/* CTC */			\
+	TCCR2B = _BV(CS22) | _BV(CS20);	/* clk/128 */	\
+	OCR2A = F_CPU / 128 / GLCD_ASYNC_HZ - 1;	\
+	TIMSK2 |= _BV(OCIE2A);						\
+} while(0)
+#endif
+
 
 /*
  * functions to perform chip selects on panel configurations
@@ -194,8 +541,8 @@
  * functions to set the pin values.
  */
 
-#if (glcd_CHIP_COUNT > 4)
-#error GLCD chip count beyond max of 4
+#if (glcd_TOTAL_CHIPS > 8)
+#error GLCD chip count (of all the panels) beyond max of 8
 #endif
 
 #if defined(glcdCSEL4)
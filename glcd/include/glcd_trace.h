@@ -0,0 +1,45 @@
+/*
+  glcd_trace.h - glcd bus trace record format
+
+  vi:ts=4
+
+  This file is part of the Arduino GLCD library.
+
+  GLCD is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as published by
+  the Free Software Foundation, either version 2.1 of the License, or
+  (at your option) any later version.
+
+  GLCD is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with GLCD.  If not, see <http://www.gnu.org/licenses/>.
+
+  With GLCD_BUS_TRACE every glcd bus transaction is recorded as 2 bytes:
+
+	type|chip	upper nibble is the record type, lower nibble the chip
+				(GLCD_TRACE_ALLCHIPS when all the chips were written at once)
+	data		the byte written or read
+
+  The same format is used by GLCD.TraceDump() and read by the
+  host replay tool in debug/host so this file has no other dependencies.
+ */
+
+#ifndef	GLCD_TRACE_H
+#define GLCD_TRACE_H
+
+#define GLCD_TRACE_CMD		0x10	// command write, data is the command
+#define GLCD_TRACE_WRITE	0x20	// display data write
+#define GLCD_TRACE_READ		0x30	// display data read (dummy reads included)
+#define GLCD_TRACE_STATUS	0x40	// status read
+#define GLCD_TRACE_MARK		0x50	// GLCD.TraceMark(), data is the mark id
+#define GLCD_TRACE_LOST		0x60	// records were lost, data is how many (255 is 255 or more)
+
+#define GLCD_TRACE_TYPE(rec)	((rec) & 0xf0)
+#define GLCD_TRACE_CHIP(rec)	((rec) & 0x0f)
+#define GLCD_TRACE_ALLCHIPS		0x0f
+
+#endif
@@ -0,0 +1,182 @@
+/*
+  mcp23017_io.h - glcd io primitives for panels on a MCP23017 I2C port expander
+
+  vi:ts=4
+
+  This file is part of the Arduino GLCD library.
+
+  GLCD is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as published by
+  the Free Software Foundation, either version 2.1 of the License, or
+  (at your option) any later version.
+
+  GLCD is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with GLCD.  If not, see <http://www.gnu.org/licenses/>.
+
+  The glcd data lines are on port A of the expander (GPA0-GPA7 = D0-D7)
+  and every control line, including the strobes, is on port B (EX_B0-EX_B7).
+
+  The expander is run in byte mode (IOCON.SEQOP) where the register
+  address toggles between OLATA and OLATB on every byte written.
+  So once a write to OLATA is started, each pair of bytes sets the data lines
+  and then the control lines, and the write is kept going for as long as
+  the glcd is being written: data out, EN high and EN low for every glcd
+  byte are just two more byte pairs in the same I2C write.
+  The device layer ends the write with lcdBusEnd() when it is done.
+
+  Control line changes other than the strobes only update the port B shadow
+  and go out with the next strobe. Because all the port B lines change together,
+  control lines that differ from what was last sent go out in a pair of their
+  own first so they are settled before the strobe rises.
+
+  The I2C byte primitives lcd_i2cStart(), lcd_i2cWrite() and lcd_i2cStop()
+  must be defined before this file is included.
+  They report a stuck bus or a missing acknowledge by setting lcd_i2cerror
+  to GLCD_EI2C, Init() fails with it and GLCD.GetError() returns it.
+  Nothing is read back, the expander's data lines are always outputs.
+ */
+
+#ifndef	MCP23017_IO_H
+#define MCP23017_IO_H
+
+#include "include/glcd_errno.h"
+
+/*
+ * MCP23017 registers (IOCON.BANK = 0)
+ */
+#define MCP23017_IODIRA		0x00
+#define MCP23017_IOCON		0x0A
+#define MCP23017_OLATA		0x14
+
+#define MCP23017_IOCON_SEQOP	0x20	// byte mode, address toggles between A/B pairs
+
+/*
+ * port B pins for the glcd control lines
+ * (only the low 3 bits are used, the rest keeps them apart from real pins)
+ */
+#define EX_B0	0x300
+#define EX_B1	0x301
+#define EX_B2	0x302
+#define EX_B3	0x303
+#define EX_B4	0x304
+#define EX_B5	0x305
+#define EX_B6	0x306
+#define EX_B7	0x307
+
+#define lcd_i2cPinBit(pin)	_BV((pin) & 7)
+
+#if defined(glcdEN)
+#define lcd_i2cIsStrobe(pin)	((pin) == glcdEN)
+#else
+#define lcd_i2cIsStrobe(pin)	((pin) == glcdE1 || (pin) == glcdE2)
+#endif
+
+extern uint8_t lcd_i2cctl;		// port B shadow
+extern uint8_t lcd_i2cdata;		// port A shadow
+extern uint8_t lcd_i2csent;		// port B as last sent
+extern uint8_t lcd_i2copen;		// an OLATA write is in progress
+extern uint8_t lcd_i2cerror;	// GLCD_EI2C after a bus failure, until GLCD.GetError()
+
+static inline void lcd_i2cPair(void) __attribute__((always_inline));
+static inline void lcd_i2cWritePin(uint16_t pin, uint8_t val) __attribute__((always_inline));
+
+void
+lcd_i2cPair(void)
+{
+	if(!lcd_i2copen)
+	{
+		lcd_i2cStart();
+		lcd_i2cWrite(glcdI2C_ADDR << 1);
+		lcd_i2cWrite(MCP23017_OLATA);
+		lcd_i2copen = 1;
+	}
+	lcd_i2cWrite(lcd_i2cdata);
+	lcd_i2cWrite(lcd_i2cctl);
+	lcd_i2csent = lcd_i2cctl;
+}
+
+void
+lcd_i2cWritePin(uint16_t pin, uint8_t val)
+{
+	if(lcd_i2cIsStrobe(pin) && (lcd_i2cctl != lcd_i2csent))
+		lcd_i2cPair();	// control lines must settle before a strobe
+
+	if(val)
+		lcd_i2cctl |= lcd_i2cPinBit(pin);
+	else
+		lcd_i2cctl &= ~lcd_i2cPinBit(pin);
+
+	if(lcd_i2cIsStrobe(pin))
+		lcd_i2cPair();
+}
+
+/*
+ * end the OLATA write so other devices can use the I2C bus
+ */
+#define lcdBusEnd()								\
+do {											\
+	if(lcd_i2copen)								\
+	{											\
+		lcd_i2cStop();							\
+		lcd_i2copen = 0;						\
+	}											\
+} while(0)
+
+/*
+ * replace the parallel bus primitives
+ */
+#undef lcdfastWrite
+#undef lcdfastWrite2
+#undef lcdPinMode
+#undef lcdDataDir
+#undef lcdDataOut
+#undef lcdDataIn
+#undef lcdRdBusystatus
+#undef lcdReset
+#undef lcdUnReset
+
+#define lcdfastWrite(pin, pinval)	lcd_i2cWritePin(pin, pinval)
+#define lcdfastWrite2(pin1, val1, pin2, val2) \
+ do {lcd_i2cWritePin(pin1, val1); lcd_i2cWritePin(pin2, val2);} while(0)
+#define lcdPinMode(pin, mode)		// expander pins are set up by lcdBusInit()
+#define lcdDataDir(dirbits)			// data lines are always outputs
+#define lcdDataOut(data)			do {lcd_i2cdata = (data);} while(0)	// goes out with the strobe
+#define lcdDataIn()					(0)
+#define lcdRdBusystatus()			(0)
+
+#ifdef glcdRES
+#define lcdReset()		do {lcd_i2cWritePin(glcdRES, 0); lcd_i2cPair(); lcdBusEnd();} while(0)
+#define lcdUnReset()	do {lcd_i2cWritePin(glcdRES, 1); lcd_i2cPair(); lcdBusEnd();} while(0)
+#else
+#define lcdReset()
+#define lcdUnReset()
+#endif
+
+/*
+ * Put the expander in byte mode and make all its pins outputs (all low).
+ */
+#define lcdBusInit() 							\
+do {											\
+	lcd_i2cInit();								\
+	lcd_i2cStart();								\
+	lcd_i2cWrite(glcdI2C_ADDR << 1);			\
+	lcd_i2cWrite(MCP23017_IOCON);				\
+	lcd_i2cWrite(MCP23017_IOCON_SEQOP);			\
+	lcd_i2cStop();								\
+	lcd_i2cdata = lcd_i2cctl = 0;				\
+	lcd_i2cPair();								\
+	lcdBusEnd();								\
+	lcd_i2cStart();								\
+	lcd_i2cWrite(glcdI2C_ADDR << 1);			\
+	lcd_i2cWrite(MCP23017_IODIRA);				\
+	lcd_i2cWrite(0x00);		/* IODIRA */		\
+	lcd_i2cWrite(0x00);		/* IODIRB */		\
+	lcd_i2cStop();								\
+} while(0)
+
+#endif // MCP23017_IO_H